@@ -0,0 +1,327 @@
+/// @file bistellar_bench.cpp
+/// @brief Benchmark each stage of the bistellar flip pipeline
+/// @author Adam Getchell
+/// @details Times get_finite_cells, get_finite_edges, find_pivot_edge,
+/// get_incident_cells, get_vertices and bistellar_flip separately on
+/// Delaunay triangulations of 10^3 to 10^7 random points. Use
+/// --benchmark_format=json, or the bench_json target, for machine-readable
+/// output.
+/// @date Created: 2026-10-16
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "flip_engine.hpp"
+#include "pivot_edge_index.hpp"
+#include "point_generators.hpp"
+#include "soa_snapshot.hpp"
+
+namespace {
+  inline constexpr std::int64_t MIN_POINTS = 1'000;
+  inline constexpr std::int64_t MAX_POINTS = 10'000'000;
+
+  /// @return A Delaunay triangulation of random points in the unit cube,
+  /// built once per size and shared by all benchmarks
+  auto triangulation_of(std::int64_t number_of_points) -> Delaunay&
+  {
+    static std::map<std::int64_t, std::unique_ptr<Delaunay>> cache;
+    auto& triangulation = cache[number_of_points];
+    if (!triangulation)
+    {
+      triangulation = std::make_unique<Delaunay>(make_random_delaunay(
+          Point_distribution::CUBE, static_cast<std::size_t>(number_of_points),
+          42));
+    }
+    return *triangulation;
+  }
+
+  /// @return The pivot edges of the triangulation, a few of them
+  auto some_pivot_edges(Delaunay const& triangulation) -> Edge_container
+  {
+    static constexpr std::size_t SAMPLES = 1024;
+    Pivot_edge_index             index(triangulation);
+    std::mt19937_64              generator(1);
+    Edge_container               edges;
+    for (std::size_t i = 0; i < SAMPLES; ++i)
+    {
+      if (auto edge = index.sample(generator)) { edges.emplace_back(*edge); }
+    }
+    return edges;
+  }
+
+  void bm_get_finite_cells(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    for (auto _ : state)
+    {
+      auto cells = get_finite_cells(triangulation);
+      benchmark::DoNotOptimize(cells.data());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(
+                                triangulation.number_of_finite_cells()));
+  }
+
+  void bm_get_finite_edges(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    for (auto _ : state)
+    {
+      auto edges = get_finite_edges(triangulation);
+      benchmark::DoNotOptimize(edges.data());
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(
+                                triangulation.number_of_finite_edges()));
+  }
+
+  /// Iterate the finite cells lazily, without a container
+  void bm_finite_cells_view(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    for (auto _ : state)
+    {
+      for (auto const& cell : finite_cells_view(triangulation))
+      {
+        benchmark::DoNotOptimize(cell);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(
+                                triangulation.number_of_finite_cells()));
+  }
+
+  /// Iterate the finite edges lazily, without a container
+  void bm_finite_edges_view(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    for (auto _ : state)
+    {
+      for (auto const& edge : finite_edges_view(triangulation))
+      {
+        benchmark::DoNotOptimize(edge);
+      }
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<std::int64_t>(
+                                triangulation.number_of_finite_edges()));
+  }
+
+  void bm_find_pivot_edge(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    auto const  edges         = get_finite_edges(triangulation);
+    for (auto _ : state)
+    {
+      auto edge = find_pivot_edge(triangulation, edges);
+      benchmark::DoNotOptimize(edge);
+    }
+  }
+
+  void bm_get_incident_cells(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    auto const  edges         = some_pivot_edges(triangulation);
+    std::size_t next          = 0;
+    for (auto _ : state)
+    {
+      auto cells = get_incident_cells(triangulation, edges[next]);
+      benchmark::DoNotOptimize(cells);
+      next = (next + 1) % edges.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void bm_get_vertices(benchmark::State& state)
+  {
+    auto const&                 triangulation = triangulation_of(state.range(0));
+    std::vector<Cell_container> incident_cells;
+    for (auto const& edge : some_pivot_edges(triangulation))
+    {
+      incident_cells.emplace_back(
+          get_incident_cells(triangulation, edge).value());
+    }
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      auto vertices = get_vertices(incident_cells[next]);
+      benchmark::DoNotOptimize(vertices.data());
+      next = (next + 1) % incident_cells.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void bm_get_octahedron_cells(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    auto const  edges         = some_pivot_edges(triangulation);
+    std::size_t next          = 0;
+    for (auto _ : state)
+    {
+      auto cells = get_octahedron_cells(triangulation, edges[next]);
+      benchmark::DoNotOptimize(cells);
+      next = (next + 1) % edges.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void bm_get_octahedron_vertices(benchmark::State& state)
+  {
+    auto const&                   triangulation = triangulation_of(state.range(0));
+    std::vector<Octahedron_cells> octahedra;
+    for (auto const& edge : some_pivot_edges(triangulation))
+    {
+      if (auto cells = get_octahedron_cells(triangulation, edge))
+      {
+        octahedra.emplace_back(*cells);
+      }
+    }
+    std::size_t next = 0;
+    for (auto _ : state)
+    {
+      auto vertices = get_octahedron_vertices(octahedra[next]);
+      benchmark::DoNotOptimize(vertices);
+      next = (next + 1) % octahedra.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  /// Flip one pivot edge and back again, so the triangulation is unchanged
+  void bm_bistellar_flip(benchmark::State& state)
+  {
+    auto&           triangulation = triangulation_of(state.range(0));
+    std::mt19937_64 generator(2);
+
+    // Find a pivot edge that can be flipped
+    Edge_handle   edge;
+    Vertex_handle top;
+    Vertex_handle bottom;
+    bool          found = false;
+    for (auto const& candidate : some_pivot_edges(triangulation))
+    {
+      auto cells = get_octahedron_cells(triangulation, candidate);
+      if (!cells) { continue; }
+      auto top_and_bottom = choose_top_and_bottom(*cells, candidate, generator);
+      if (top_and_bottom &&
+          plan_flip(triangulation, candidate, top_and_bottom->first,
+                    top_and_bottom->second))
+      {
+        edge   = candidate;
+        top    = top_and_bottom->first;
+        bottom = top_and_bottom->second;
+        found  = true;
+        break;
+      }
+    }
+    if (!found)
+    {
+      state.SkipWithError("No flippable pivot edge");
+      return;
+    }
+
+    for (auto _ : state)
+    {
+      auto forward = bistellar_flip(triangulation, edge, top, bottom);
+      auto back =
+          bistellar_flip(triangulation, forward.pivot_edge, top, bottom);
+      if (!forward || !back)
+      {
+        state.SkipWithError("Flip was rejected");
+        break;
+      }
+      edge = back.pivot_edge;
+    }
+    state.SetItemsProcessed(2 * state.iterations());
+  }
+
+  /// Flip a private copy, so the shared triangulation stays Delaunay for
+  /// the benchmarks after this one
+  void bm_flip_engine(benchmark::State& state)
+  {
+    Delaunay    triangulation = triangulation_of(state.range(0));
+    Flip_engine engine(triangulation, 3);
+    for (auto _ : state)
+    {
+      auto status = engine.step();
+      benchmark::DoNotOptimize(status);
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void bm_make_soa_snapshot(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    for (auto _ : state)
+    {
+      auto snapshot = make_soa_snapshot(triangulation);
+      benchmark::DoNotOptimize(snapshot);
+    }
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(triangulation.number_of_cells()));
+  }
+
+  void bm_sweep_statistics(benchmark::State& state)
+  {
+    auto const& triangulation = triangulation_of(state.range(0));
+    auto const  snapshot      = make_soa_snapshot(triangulation);
+    for (auto _ : state)
+    {
+      auto statistics = sweep_statistics(snapshot);
+      benchmark::DoNotOptimize(statistics);
+    }
+    state.SetItemsProcessed(
+        state.iterations() *
+        static_cast<std::int64_t>(snapshot.number_of_cells()));
+  }
+}  // namespace
+
+BENCHMARK(bm_get_finite_cells)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_get_finite_edges)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_finite_cells_view)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_finite_edges_view)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bm_find_pivot_edge)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS);
+BENCHMARK(bm_get_incident_cells)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS);
+BENCHMARK(bm_get_vertices)->RangeMultiplier(10)->Range(MIN_POINTS, MAX_POINTS);
+BENCHMARK(bm_get_octahedron_cells)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS);
+BENCHMARK(bm_get_octahedron_vertices)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS);
+BENCHMARK(bm_bistellar_flip)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS);
+BENCHMARK(bm_flip_engine)->RangeMultiplier(10)->Range(MIN_POINTS, MAX_POINTS);
+
+BENCHMARK(bm_make_soa_snapshot)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS);
+BENCHMARK(bm_sweep_statistics)
+    ->RangeMultiplier(10)
+    ->Range(MIN_POINTS, MAX_POINTS);
+
+BENCHMARK_MAIN();
@@ -35,6 +35,14 @@ if(ENABLE_IPO)
   endif()
 endif()
 
+# Flip pipeline instrumentation
+# Stage timers and outcome counters compile out completely when this is off
+option(ENABLE_INSTRUMENTATION "Time the stages of bistellar flips and count their outcomes" OFF)
+if(ENABLE_INSTRUMENTATION)
+  add_compile_definitions(BISTELLAR_FLIP_INSTRUMENTATION)
+  message(STATUS "Instrumentation enabled.")
+endif()
+
 # Set minimum Boost version
 set(BOOST_MIN_VERSION "1.75.0")
 
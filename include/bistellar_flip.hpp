@@ -21,26 +21,30 @@
 #include <CGAL/iterator.h>
 #include <CGAL/Mpzf.h>
 #include <CGAL/Point_3.h>
-#include <CGAL/Triangulation_cell_base_with_info_3.h>
 #include <CGAL/Triangulation_data_structure_3.h>
-#include <CGAL/Triangulation_vertex_base_with_info_3.h>
 #include <CGAL/utility.h>
 #include <fmt/core.h>
 
 #include <algorithm>
+#include <array>
 #include <boost/container/small_vector.hpp>
 #include <boost/container/vector.hpp>
+#include <cstddef>
 #include <iostream>
+#include <iterator>
 #include <optional>
+#include <ranges>
 #include <string>
+#include <type_traits>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
-using K   = CGAL::Exact_predicates_inexact_constructions_kernel;
-using Vb  = CGAL::Triangulation_vertex_base_with_info_3<int, K>;
-using Cb  = CGAL::Triangulation_cell_base_with_info_3<int, K>;
-using Tds = CGAL::Triangulation_data_structure_3<Vb, Cb, CGAL::Sequential_tag>;
-using Delaunay         = CGAL::Delaunay_triangulation_3<K, Tds>;
+#include "flip_status.hpp"
+#include "instrumentation.hpp"
+#include "orientation_filter.hpp"
+#include "triangulation_config.hpp"
+
 using Cell_handle      = Delaunay::Cell_handle;
 using Edge_handle      = CGAL::Triple<Cell_handle, int, int>;
 using Vertex_handle    = Delaunay::Vertex_handle;
@@ -49,32 +53,147 @@ using Cell_container   = std::vector<Cell_handle>;
 using Edge_container   = std::vector<Edge_handle>;
 using Vertex_container = std::vector<Vertex_handle>;
 
+/// The handle types of any triangulation; the names above are those of the
+/// default configuration
+template <typename Triangulation>
+using Cell_handle_t = typename Triangulation::Cell_handle;
+template <typename Triangulation>
+using Edge_handle_t = CGAL::Triple<Cell_handle_t<Triangulation>, int, int>;
+template <typename Triangulation>
+using Vertex_handle_t = typename Triangulation::Vertex_handle;
+
+/// The type of vertex handle held by a cell handle
+template <typename Cell_handle_type>
+using Vertex_handle_of = std::remove_cvref_t<
+    decltype(std::declval<Cell_handle_type const&>()->vertex(0))>;
+
+/// @brief Adapts a CGAL iterator to yield handles by value
+/// @details CGAL's finite iterators dereference to cells and vertices, not
+/// handles, and do not model the C++20 iterator concepts. This wrapper does,
+/// so the finite simplices can be used with std::ranges and std::views.
+template <typename Iterator, typename Value>
+class Handle_iterator
+{
+ public:
+  using value_type       = Value;
+  using difference_type  = std::ptrdiff_t;
+  using iterator_concept = std::forward_iterator_tag;
+
+  Handle_iterator() = default;
+  explicit Handle_iterator(Iterator iterator) : m_iterator{iterator} {}
+
+  auto operator*() const -> Value
+  {
+    if constexpr (std::is_constructible_v<Value, Iterator>)
+    {
+      return Value(m_iterator);
+    }
+    else { return *m_iterator; }
+  }
+
+  auto operator++() -> Handle_iterator&
+  {
+    ++m_iterator;
+    return *this;
+  }
+
+  auto operator++(int) -> Handle_iterator
+  {
+    auto previous = *this;
+    ++m_iterator;
+    return previous;
+  }
+
+  friend auto operator==(Handle_iterator const& lhs, Handle_iterator const& rhs)
+      -> bool
+  {
+    return lhs.m_iterator == rhs.m_iterator;
+  }
+
+ private:
+  Iterator m_iterator{};
+};
+
+/// @brief A lazy, non-owning view of simplices between two CGAL iterators
+template <typename Iterator, typename Value>
+class Handle_view
+    : public std::ranges::view_interface<Handle_view<Iterator, Value>>
+{
+ public:
+  Handle_view() = default;
+  Handle_view(Iterator first, Iterator last) : m_first{first}, m_last{last} {}
+
+  [[nodiscard]] auto begin() const
+  {
+    return Handle_iterator<Iterator, Value>{m_first};
+  }
+
+  [[nodiscard]] auto end() const
+  {
+    return Handle_iterator<Iterator, Value>{m_last};
+  }
+
+ private:
+  Iterator m_first{};
+  Iterator m_last{};
+};
+
+/// @return A view of the finite cells in the triangulation; nothing is
+/// copied or allocated
+template <typename Triangulation>
+[[nodiscard]] auto finite_cells_view(Triangulation const& triangulation)
+{
+  return Handle_view<typename Triangulation::Finite_cells_iterator,
+                     Cell_handle_t<Triangulation>>{
+      triangulation.finite_cells_begin(), triangulation.finite_cells_end()};
+}  // finite_cells_view()
+
+/// @return A view of the finite edges in the triangulation; nothing is
+/// copied or allocated
+template <typename Triangulation>
+[[nodiscard]] auto finite_edges_view(Triangulation const& triangulation)
+{
+  return Handle_view<typename Triangulation::Finite_edges_iterator,
+                     Edge_handle_t<Triangulation>>{
+      triangulation.finite_edges_begin(), triangulation.finite_edges_end()};
+}  // finite_edges_view()
+
+/// @return A view of the finite vertices in the triangulation; nothing is
+/// copied or allocated
+template <typename Triangulation>
+[[nodiscard]] auto finite_vertices_view(Triangulation const& triangulation)
+{
+  return Handle_view<typename Triangulation::Finite_vertices_iterator,
+                     Vertex_handle_t<Triangulation>>{
+      triangulation.finite_vertices_begin(),
+      triangulation.finite_vertices_end()};
+}  // finite_vertices_view()
+
 /// @return A container of all the finite cells in the triangulation.
-[[nodiscard]] inline auto get_finite_cells(Delaunay const& triangulation)
-    -> Cell_container
+template <typename Triangulation>
+[[nodiscard]] auto get_finite_cells(Triangulation const& triangulation)
+    -> std::vector<Cell_handle_t<Triangulation>>
 {
-  Cell_container cells;
-  for (auto cit = triangulation.finite_cells_begin();
-       cit != triangulation.finite_cells_end(); ++cit)
+  std::vector<Cell_handle_t<Triangulation>> cells;
+  cells.reserve(triangulation.number_of_finite_cells());
+  for (auto const& cell : finite_cells_view(triangulation))
   {
     // Each cell handle is valid
-    assert(triangulation.tds().is_cell(cit));
-    cells.emplace_back(cit);
+    assert(triangulation.tds().is_cell(cell));
+    cells.emplace_back(cell);
   }
   return cells;
 }  // get_finite_cells()
 
 /// @return A container of all the finite edges in the triangulation.
-[[nodiscard]] inline auto get_finite_edges(Delaunay const& triangulation)
-    -> Edge_container
+template <typename Triangulation>
+[[nodiscard]] auto get_finite_edges(Triangulation const& triangulation)
+    -> std::vector<Edge_handle_t<Triangulation>>
 {
-  Edge_container edges;
-  for (auto eit = triangulation.finite_edges_begin();
-       eit != triangulation.finite_edges_end(); ++eit)
+  std::vector<Edge_handle_t<Triangulation>> edges;
+  edges.reserve(triangulation.number_of_finite_edges());
+  for (auto const& edge : finite_edges_view(triangulation))
   {
-    Cell_handle const cell = eit->first;
-    Edge_handle const edge{cell, cell->index(cell->vertex(eit->second)),
-                           cell->index(cell->vertex(eit->third))};
     // Each edge handle is valid
     assert(triangulation.tds().is_valid(edge.first, edge.second, edge.third));
     edges.emplace_back(edge);
@@ -82,45 +201,95 @@ using Vertex_container = std::vector<Vertex_handle>;
   return edges;
 }  // get_finite_edges()
 
-/// @return An edge with 4 incident finite cells
-[[nodiscard]] inline auto find_pivot_edge(Delaunay const&       triangulation,
-                                          Edge_container const& edges)
-    -> std::optional<Edge_handle>
+/// @return The number of finite cells incident to an edge
+template <typename Triangulation>
+[[nodiscard]] auto count_finite_incident_cells(
+    Triangulation const&                triangulation,
+    Edge_handle_t<Triangulation> const& edge) -> std::size_t
+{
+  std::size_t count      = 0;
+  auto        circulator = triangulation.incident_cells(edge, edge.first);
+  do {
+    // filter out boundary edges with incident infinite cells
+    if (!triangulation.is_infinite(circulator)) { ++count; }
+  }
+  while (++circulator != edge.first);
+  return count;
+}  // count_finite_incident_cells()
+
+/// @brief Check that an edge can be used as a pivot edge
+/// @details Edges on the hull also have infinite cells, so counting only the
+/// finite ones is not enough: they cannot be flipped even with 4.
+/// @return True if the edge has exactly 4 incident cells, all finite
+template <typename Triangulation>
+[[nodiscard]] auto is_pivot_edge(
+    Triangulation const&                triangulation,
+    Edge_handle_t<Triangulation> const& edge) -> bool
+{
+  std::size_t count      = 0;
+  auto        circulator = triangulation.incident_cells(edge, edge.first);
+  do {
+    if (++count > 4 || triangulation.is_infinite(circulator)) { return false; }
+  }
+  while (++circulator != edge.first);
+  return count == 4;
+}  // is_pivot_edge()
+
+/// @return A view of the edges with exactly 4 incident cells, all finite
+template <typename Triangulation>
+[[nodiscard]] auto pivot_edges_view(Triangulation const& triangulation)
+{
+  return finite_edges_view(triangulation) |
+         std::views::filter(
+             [&triangulation](Edge_handle_t<Triangulation> const& edge) {
+               return is_pivot_edge(triangulation, edge);
+             });
+}  // pivot_edges_view()
+
+/// @return An edge with exactly 4 incident cells, all finite
+template <typename Triangulation>
+[[nodiscard]] auto find_pivot_edge(
+    Triangulation const&                             triangulation,
+    std::vector<Edge_handle_t<Triangulation>> const& edges)
+    -> std::optional<Edge_handle_t<Triangulation>>
 {
   for (auto const& edge : edges)
   {
-    auto           circulator = triangulation.incident_cells(edge, edge.first);
-    Cell_container incident_cells;
-    do {
-      // filter out boundary edges with incident infinite cells
-      if (!triangulation.is_infinite(circulator))
-      {
-        incident_cells.emplace_back(circulator);
-      }
-    }
-    while (++circulator != edge.first);
-    if (incident_cells.size() == 4) { return edge; }
+    if (is_pivot_edge(triangulation, edge)) { return edge; }
   }
   return std::nullopt;
 }  // find_pivot_edge()
 
+/// @return An edge with exactly 4 incident cells, all finite, found without
+/// copying the edges of the triangulation
+template <typename Triangulation>
+[[nodiscard]] auto find_pivot_edge(Triangulation const& triangulation)
+    -> std::optional<Edge_handle_t<Triangulation>>
+{
+  auto pivot_edges = pivot_edges_view(triangulation);
+  if (pivot_edges.begin() == pivot_edges.end()) { return std::nullopt; }
+  return *pivot_edges.begin();
+}  // find_pivot_edge()
+
 /// @return A container of all finite vertices in the triangulation.
-[[nodiscard]] inline auto get_finite_vertices(Delaunay const& triangulation)
-    -> Vertex_container
+template <typename Triangulation>
+[[nodiscard]] auto get_finite_vertices(Triangulation const& triangulation)
+    -> std::vector<Vertex_handle_t<Triangulation>>
 {
-  Vertex_container vertices;
-  for (auto vit = triangulation.finite_vertices_begin();
-       vit != triangulation.finite_vertices_end(); ++vit)
+  std::vector<Vertex_handle_t<Triangulation>> vertices;
+  vertices.reserve(triangulation.number_of_vertices());
+  for (auto const& vertex : finite_vertices_view(triangulation))
   {
-    assert(triangulation.tds().is_vertex(vit));
-    vertices.emplace_back(vit);
+    assert(triangulation.tds().is_vertex(vertex));
+    vertices.emplace_back(vertex);
   }
   return vertices;
 }  // get_finite_vertices()
 
 /// @brief Print the edge in human-readable form.
 /// @param edge The edge to print.
-inline void print_edge(Edge_handle const& edge)
+template <typename Cell_handle_type>
+void print_edge(CGAL::Triple<Cell_handle_type, int, int> const& edge)
 {
   auto              Point1 = edge.first->vertex(edge.second)->point();
   std::stringstream point1_ss;
@@ -136,16 +305,18 @@ inline void print_edge(Edge_handle const& edge)
 /// @param triangulation The triangulation with the cells.
 /// @param edge The edge to find the incident cells.
 /// @return A container of cells incident to an edge, or std::nullopt
-[[nodiscard]] inline auto get_incident_cells(Delaunay const&    triangulation,
-                                             Edge_handle const& edge)
-    -> std::optional<Cell_container>
+template <typename Triangulation>
+[[nodiscard]] auto get_incident_cells(
+    Triangulation const&                triangulation,
+    Edge_handle_t<Triangulation> const& edge)
+    -> std::optional<std::vector<Cell_handle_t<Triangulation>>>
 {
   if (!triangulation.tds().is_valid(edge.first, edge.second, edge.third))
   {
     return std::nullopt;
   }
-  auto           circulator = triangulation.incident_cells(edge, edge.first);
-  Cell_container incident_cells;
+  auto circulator = triangulation.incident_cells(edge, edge.first);
+  std::vector<Cell_handle_t<Triangulation>> incident_cells;
   do {
     // filter out boundary edges with incident infinite cells
     if (!triangulation.is_infinite(circulator))
@@ -161,82 +332,505 @@ inline void print_edge(Edge_handle const& edge)
 /// @brief Return a container of vertices from a container of cells.
 /// @param cells The container of cells.
 /// @return A container of vertices in the cells
-[[nodiscard]] inline auto get_vertices(Cell_container const& cells)
+template <typename Cell_handle_type>
+[[nodiscard]] auto get_vertices(std::vector<Cell_handle_type> const& cells)
 {
-  std::unordered_set<Vertex_handle> vertices;
+  using Vertex_handle_type = Vertex_handle_of<Cell_handle_type>;
+  std::unordered_set<Vertex_handle_type> vertices;
   auto get_vertices = [&vertices](auto const& cell) {
     for (int i = 0; i < 4; ++i) { vertices.emplace(cell->vertex(i)); }
   };
   std::for_each(cells.begin(), cells.end(), get_vertices);
-  Vertex_container result{vertices.begin(), vertices.end()};
+  std::vector<Vertex_handle_type> result{vertices.begin(), vertices.end()};
   return result;
 }  // get_vertices()
 
-[[nodiscard]] inline auto index_of_vertex_in_opposite_simplex(
-    Delaunay& triangulation, Cell_handle cell, int index) -> int
+/// The 4 cells around a pivot edge
+template <typename Cell_handle_type>
+using Basic_octahedron_cells = std::array<Cell_handle_type, 4>;
+/// The 6 vertices of the 4 cells around a pivot edge
+template <typename Vertex_handle_type>
+using Basic_octahedron_vertices = std::array<Vertex_handle_type, 6>;
+using Octahedron_cells          = Basic_octahedron_cells<Cell_handle>;
+using Octahedron_vertices       = Basic_octahedron_vertices<Vertex_handle>;
+
+/// @brief Return the 4 cells around an edge without allocating.
+/// @details Unlike get_incident_cells(), infinite cells are not skipped: the
+/// edge must have exactly 4 incident cells, all of them finite.
+/// @param triangulation The triangulation with the cells.
+/// @param edge A valid edge.
+/// @return The 4 cells in circulation order, or std::nullopt
+template <typename Triangulation>
+[[nodiscard]] auto get_octahedron_cells(
+    Triangulation const&                triangulation,
+    Edge_handle_t<Triangulation> const& edge)
+    -> std::optional<Basic_octahedron_cells<Cell_handle_t<Triangulation>>>
+{
+  Basic_octahedron_cells<Cell_handle_t<Triangulation>> cells;
+  std::size_t      count      = 0;
+  auto             circulator = triangulation.incident_cells(edge, edge.first);
+  do {
+    if (count == cells.size() || triangulation.is_infinite(circulator))
+    {
+      return std::nullopt;
+    }
+    cells[count++] = circulator;
+  }
+  while (++circulator != edge.first);
+
+  if (count != cells.size()) { return std::nullopt; }
+  return cells;
+}  // get_octahedron_cells()
+
+/// @brief Return the 6 vertices of the cells around a pivot edge without
+/// allocating.
+/// @details Duplicates among the 16 vertices are removed by linear scan,
+/// which is cheaper than hashing at this size.
+/// @param cells The 4 cells around a pivot edge.
+/// @return The 6 distinct vertices, or std::nullopt if there are not 6
+template <typename Cell_handle_type>
+[[nodiscard]] auto get_octahedron_vertices(
+    Basic_octahedron_cells<Cell_handle_type> const& cells)
+    -> std::optional<
+        Basic_octahedron_vertices<Vertex_handle_of<Cell_handle_type>>>
+{
+  Basic_octahedron_vertices<Vertex_handle_of<Cell_handle_type>> vertices;
+  std::size_t count = 0;
+  for (auto const& cell : cells)
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const vertex = cell->vertex(i);
+      auto const last =
+          std::next(vertices.begin(), static_cast<std::ptrdiff_t>(count));
+      if (std::find(vertices.begin(), last, vertex) != last) { continue; }
+      if (count == vertices.size()) { return std::nullopt; }
+      vertices[count++] = vertex;
+    }
+  }
+
+  if (count != vertices.size()) { return std::nullopt; }
+  return vertices;
+}  // get_octahedron_vertices()
+
+/// The 3 diagonals of an octahedron, each joining 2 opposite vertices
+template <typename Vertex_handle_type>
+using Basic_octahedron_diagonals =
+    std::array<std::pair<Vertex_handle_type, Vertex_handle_type>, 3>;
+using Octahedron_diagonals = Basic_octahedron_diagonals<Vertex_handle>;
+
+/// @brief Return the 3 diagonals of the octahedron around a pivot edge
+/// @details The first diagonal is the pivot edge itself. The other 2 join
+/// opposite vertices of the ring of 4 vertices around it, i.e. vertices
+/// that share no cell. A bistellar flip with top and bottom on one ring
+/// diagonal replaces the pivot edge with the other ring diagonal, so these
+/// are the only choices of top and bottom, and no point location is needed
+/// to find them.
+/// @param cells The 4 cells around the pivot edge
+/// @param pivot_from_1 One vertex of the pivot edge
+/// @param pivot_from_2 The other vertex of the pivot edge
+/// @return The pivot edge and the 2 ring diagonals, or std::nullopt
+template <typename Cell_handle_type>
+[[nodiscard]] auto get_octahedron_diagonals(
+    Basic_octahedron_cells<Cell_handle_type> const& cells,
+    Vertex_handle_of<Cell_handle_type> const&       pivot_from_1,
+    Vertex_handle_of<Cell_handle_type> const&       pivot_from_2)
+    -> std::optional<
+        Basic_octahedron_diagonals<Vertex_handle_of<Cell_handle_type>>>
+{
+  auto const vertices = get_octahedron_vertices(cells);
+  if (!vertices) { return std::nullopt; }
+
+  std::array<Vertex_handle_of<Cell_handle_type>, 4> ring;
+  std::size_t                                       count = 0;
+  for (auto const& vertex : vertices.value())
+  {
+    if (vertex == pivot_from_1 || vertex == pivot_from_2) { continue; }
+    if (count == ring.size()) { return std::nullopt; }
+    ring[count++] = vertex;
+  }
+  if (count != ring.size()) { return std::nullopt; }
+
+  auto const are_opposite = [&cells](auto const& first, auto const& second) {
+    return std::none_of(cells.begin(), cells.end(), [&](auto const& cell) {
+      return cell->has_vertex(first) && cell->has_vertex(second);
+    });
+  };
+  // Move the vertex opposite ring[0] to ring[1]
+  auto const opposite = std::find_if(
+      std::next(ring.begin()), ring.end(),
+      [&](auto const& vertex) { return are_opposite(ring[0], vertex); });
+  if (opposite == ring.end()) { return std::nullopt; }
+  std::iter_swap(std::next(ring.begin()), opposite);
+  if (!are_opposite(ring[2], ring[3])) { return std::nullopt; }
+
+  return Basic_octahedron_diagonals<Vertex_handle_of<Cell_handle_type>>{
+      {{pivot_from_1, pivot_from_2}, {ring[0], ring[1]}, {ring[2], ring[3]}}
+  };
+}  // get_octahedron_diagonals()
+
+/// @brief Return the 3 diagonals of the octahedron around a pivot edge
+/// @param triangulation The triangulation with the pivot edge
+/// @param edge The pivot edge
+/// @return The pivot edge and the 2 ring diagonals, or std::nullopt if the
+/// edge is not a pivot edge
+template <typename Triangulation>
+[[nodiscard]] auto get_octahedron_diagonals(
+    Triangulation const&                triangulation,
+    Edge_handle_t<Triangulation> const& edge)
+    -> std::optional<
+        Basic_octahedron_diagonals<Vertex_handle_t<Triangulation>>>
+{
+  if (!triangulation.tds().is_valid(edge.first, edge.second, edge.third))
+  {
+    return std::nullopt;
+  }
+  auto const cells = get_octahedron_cells(triangulation, edge);
+  if (!cells) { return std::nullopt; }
+  return get_octahedron_diagonals(*cells, edge.first->vertex(edge.second),
+                                  edge.first->vertex(edge.third));
+}  // get_octahedron_diagonals()
+
+template <typename Triangulation>
+[[nodiscard]] auto index_of_vertex_in_opposite_simplex(
+    Triangulation& triangulation, Cell_handle_t<Triangulation> cell, int index)
+    -> int
 {
   //  auto neighboring_cell = cell->neighbor(index);
   return triangulation.mirror_index(cell, index);
 }  // index_of_vertex_in_opposite_simplex()
 
-/// @brief Perform a bistellar flip on triangulation via the given edge
+/// @brief The result of an in-place bistellar flip
+/// @details Only the handles of the new cells and the new pivot edge are
+/// returned; the triangulation itself is modified in place.
+template <typename Triangulation>
+struct Basic_flip_result
+{
+  Flip_status status{Flip_status::INVALID_EDGE};
+  /// The new cells after_1, after_2, after_3, after_4
+  std::array<Cell_handle_t<Triangulation>, 4> cells{};
+  /// The new pivot edge from Pivot_to_1 to Pivot_to_2
+  Edge_handle_t<Triangulation> pivot_edge{};
+
+  explicit operator bool() const { return status == Flip_status::SUCCESS; }
+};
+
+using Flip_result = Basic_flip_result<Delaunay>;
+
+/// @brief How bistellar_flip checks the cells it creates
+enum class Flip_validation
+{
+  /// Check only the octahedral complex and its 8 exterior neighbors
+  LOCAL,
+  /// Also walk the whole triangulation data structure; for debugging
+  GLOBAL,
+  /// As LOCAL, and before changing anything, reject the flip with
+  /// Flip_status::INVERTED_CELL if a new cell would be flat or negatively
+  /// oriented
+  GEOMETRIC
+};
+
+/// @brief Reverse the orientation of a single cell.
+/// @details Swaps vertices 0 and 1 together with neighbors 0 and 1. This is
+/// what Triangulation_data_structure_3::reorient() does to every cell, but
+/// it is not exposed for individual cells.
+/// @param cell The cell to reorient
+template <typename Cell_handle_type>
+void change_orientation(Cell_handle_type const& cell)
+{
+  auto const vertex = cell->vertex(0);
+  cell->set_vertex(0, cell->vertex(1));
+  cell->set_vertex(1, vertex);
+  auto const neighbor = cell->neighbor(0);
+  cell->set_neighbor(0, cell->neighbor(1));
+  cell->set_neighbor(1, neighbor);
+}  // change_orientation()
+
+/// @brief Check that a cell and its i-th neighbor agree on their facet.
+/// @details The neighbor must point back at the cell, share the 3 vertices
+/// of the facet, and induce the opposite orientation on it, i.e. the map from
+/// vertex indices of the cell to vertex indices of the neighbor is an odd
+/// permutation.
+/// @param cell The cell to check
+/// @param index The index of the facet, opposite vertex index
+/// @return True if the facet is consistent
+template <typename Cell_handle_type>
+[[nodiscard]] auto is_consistently_oriented(Cell_handle_type const& cell,
+                                            int                     index)
+    -> bool
+{
+  auto const         neighbor = cell->neighbor(index);
+  std::array<int, 4> permutation{};
+  unsigned           seen = 0;
+  for (int i = 0; i < 4; ++i)
+  {
+    int mirror = 0;
+    if (i == index ? !neighbor->has_neighbor(cell, mirror)
+                   : !neighbor->has_vertex(cell->vertex(i), mirror))
+    {
+      return false;
+    }
+    permutation[static_cast<std::size_t>(i)] = mirror;
+    seen |= 1U << static_cast<unsigned>(mirror);
+  }
+  if (seen != 0b1111U) { return false; }
+
+  int inversions = 0;
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    for (std::size_t j = i + 1; j < 4; ++j)
+    {
+      if (permutation[i] > permutation[j]) { ++inversions; }
+    }
+  }
+  return inversions % 2 == 1;
+}  // is_consistently_oriented()
+
+/// @brief Fix the orientation of the new cells of a flip.
+/// @details Each cell is compared against one of its neighbors outside the
+/// complex and reoriented if they disagree. Only the given cells are touched,
+/// unlike Triangulation_data_structure_3::reorient().
+/// @param cells The cells of the octahedral complex
+/// @return A mask with bit i set if cells[i] was reoriented
+template <typename Cell_handle_type>
+auto reorient_locally(std::array<Cell_handle_type, 4> const& cells)
+    -> unsigned
+{
+  unsigned reoriented = 0;
+  for (std::size_t c = 0; c < cells.size(); ++c)
+  {
+    auto const& cell = cells[c];
+    for (int i = 0; i < 4; ++i)
+    {
+      if (std::find(cells.begin(), cells.end(), cell->neighbor(i)) !=
+          cells.end())
+      {
+        continue;
+      }
+      if (!is_consistently_oriented(cell, i))
+      {
+        change_orientation(cell);
+        reoriented |= 1U << c;
+      }
+      break;
+    }
+  }
+  return reoriented;
+}  // reorient_locally()
+
+/// @brief Check the cells of an octahedral complex and their neighbors.
+/// @details Validates the 4 cells and, through their facets, the adjacency
+/// and orientation of the 8 exterior neighbors. The rest of the
+/// triangulation is not visited, and every check is O(1). Membership of the
+/// handles in the triangulation is only asserted, because on a
+/// Compact_container it walks every storage block.
+/// @param triangulation The triangulation containing the cells
+/// @param cells The cells of the octahedral complex
+/// @return True if the complex is valid
+template <typename Triangulation>
+[[nodiscard]] auto is_locally_valid(
+    [[maybe_unused]] Triangulation const&              triangulation,
+    std::array<Cell_handle_t<Triangulation>, 4> const& cells) -> bool
+{
+  for (auto const& cell : cells)
+  {
+    assert(triangulation.tds().is_cell(cell));
+    if (!cell->is_valid()) { return false; }
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const vertex = cell->vertex(i);
+      assert(triangulation.tds().is_vertex(vertex));
+      assert(triangulation.tds().is_cell(cell->neighbor(i)));
+      if (!vertex->cell()->has_vertex(vertex) ||
+          !is_consistently_oriented(cell, i))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}  // is_locally_valid()
+
+/// @brief Find a cell incident to a vertex that satisfies a predicate.
+/// @details Walks the cells incident to the vertex with a local list of
+/// visited cells. Unlike Triangulation_data_structure_3::is_edge(), no cells
+/// are marked, so this is safe to call from several threads at once.
+/// @param vertex The vertex whose star is searched
+/// @param predicate Called with each incident cell until it returns true
+/// @return The first incident cell satisfying the predicate, or std::nullopt
+template <typename Vertex_handle_type, typename Predicate>
+[[nodiscard]] auto find_incident_cell(Vertex_handle_type const& vertex,
+                                      Predicate&&               predicate)
+    -> std::optional<std::remove_cvref_t<decltype(vertex->cell())>>
+{
+  using Cell_handle_type = std::remove_cvref_t<decltype(vertex->cell())>;
+  boost::container::small_vector<Cell_handle_type, 64> star{vertex->cell()};
+  for (std::size_t next = 0; next < star.size(); ++next)
+  {
+    auto const cell = star[next];
+    if (predicate(cell)) { return cell; }
+    auto const opposite = cell->index(vertex);
+    for (int i = 0; i < 4; ++i)
+    {
+      if (i == opposite) { continue; }
+      // Neighbors across facets containing vertex are in its star
+      auto const neighbor = cell->neighbor(i);
+      if (std::find(star.begin(), star.end(), neighbor) == star.end())
+      {
+        star.emplace_back(neighbor);
+      }
+    }
+  }
+  return std::nullopt;
+}  // find_incident_cell()
+
+/// @brief Check whether two vertices are joined by an edge.
+/// @param first One endpoint
+/// @param second The other endpoint
+/// @return True if the edge exists
+template <typename Vertex_handle_type>
+[[nodiscard]] auto has_edge(Vertex_handle_type const& first,
+                            Vertex_handle_type const& second) -> bool
+{
+  return find_incident_cell(first, [&second](auto const& cell) {
+           return cell->has_vertex(second);
+         }).has_value();
+}  // has_edge()
+
+/// @brief Everything a bistellar flip needs, gathered before any mutation
+/// @details Planning only reads the triangulation, so plans for different
+/// pivot edges can be made concurrently. Applying a plan touches only the 4
+/// old cells, their 8 exterior neighbors, and the 6 vertices.
+template <typename Triangulation>
+struct Basic_flip_plan
+{
+  using Cell_handle   = Cell_handle_t<Triangulation>;
+  using Vertex_handle = Vertex_handle_t<Triangulation>;
+
+  Flip_status   status{Flip_status::INVALID_EDGE};
+  Vertex_handle top{};
+  Vertex_handle bottom{};
+  Vertex_handle pivot_from_1{};
+  Vertex_handle pivot_from_2{};
+  Vertex_handle pivot_to_1{};
+  Vertex_handle pivot_to_2{};
+  /// The old cells before_1, before_2, before_3, before_4
+  std::array<Cell_handle, 4> cells{};
+  /// The exterior neighbors n_1 ... n_8
+  std::array<Cell_handle, 8> neighbors{};
+  /// The index of the old cell in each exterior neighbor, m_1 ... m_8
+  std::array<int, 8>         mirrors{};
+
+  explicit operator bool() const { return status == Flip_status::SUCCESS; }
+
+  /// @return The 6 vertices of the octahedral complex
+  [[nodiscard]] auto vertices() const -> std::array<Vertex_handle, 6>
+  {
+    return {top,          bottom,     pivot_from_1,
+            pivot_from_2, pivot_to_1, pivot_to_2};
+  }
+};
+
+using Flip_plan = Basic_flip_plan<Delaunay>;
+
+/// @brief Check a bistellar flip and gather what is needed to apply it,
+/// without recording the outcome
+/// @details The triangulation is not modified. Use this to plan flips of
+/// which at most one is applied, and record the outcome of that one.
 /// @param triangulation The triangulation to flip
 /// @param edge The edge to pivot on
 /// @param top Top vertex of the cells being flipped
 /// @param bottom Bottom vertex of the cells being flipped
-/// @return A flipped triangulation if successful
-[[nodiscard]] inline auto bistellar_flip(Delaunay&            triangulation,
-                                         Edge_handle const&   edge,
-                                         Vertex_handle const& top,
-                                         Vertex_handle const& bottom)
-    -> std::optional<Delaunay>
+/// @return The plan, or the reason the flip would be rejected
+template <typename Triangulation>
+[[nodiscard]] auto plan_flip_unrecorded(
+    Triangulation const&                  triangulation,
+    Edge_handle_t<Triangulation> const&   edge,
+    Vertex_handle_t<Triangulation> const& top,
+    Vertex_handle_t<Triangulation> const& bottom)
+    -> Basic_flip_plan<Triangulation>
 {
-  // Get the cells incident to the edge
-  auto incident_cells = get_incident_cells(triangulation, edge);
+  using Plan = Basic_flip_plan<Triangulation>;
+  Stage_timer timer(Flip_stage::INCIDENT_CELLS);
+
+  if (!triangulation.tds().is_valid(edge.first, edge.second, edge.third))
+  {
+    return Plan{Flip_status::INVALID_EDGE};
+  }
 
-  // Check that there are exactly 4 incident cells
-  if (!incident_cells || incident_cells->size() != 4) { return std::nullopt; }
+  // Get the cells incident to the edge; there must be exactly 4, all finite
+  auto const incident_cells = get_octahedron_cells(triangulation, edge);
+  if (!incident_cells)
+  {
+    return Plan{Flip_status::WRONG_VALENCE};
+  }
 
   // Check incident cells are valid
-  //  for (auto const& cell : incident_cells.value())
-  //  {
-  //    if (!cell->is_valid()) { return std::nullopt; }
-  //  }
   if (std::any_of(incident_cells->begin(), incident_cells->end(),
                   [](auto const& cell) { return !cell->is_valid(); }))
   {
-    return std::nullopt;
+    return Plan{Flip_status::INVALID_CELL};
   }
 
+  timer.next(Flip_stage::CLASSIFICATION);
+
   // Get vertices from pivot edge
-  auto const& pivot_from_1 = edge.first->vertex(edge.second);
-  auto const& pivot_from_2 = edge.first->vertex(edge.third);
+  auto const pivot_from_1 = edge.first->vertex(edge.second);
+  auto const pivot_from_2 = edge.first->vertex(edge.third);
 
   // Get vertices from cells
-  auto vertices            = get_vertices(incident_cells.value());
+  auto const vertices     = get_octahedron_vertices(incident_cells.value());
+  if (!vertices) { return Plan{Flip_status::INVALID_CELL}; }
 
   // Get vertices for new pivot edge
-  Vertex_container new_pivot_vertices;
-  std::copy_if(vertices.begin(), vertices.end(),
-               std::back_inserter(new_pivot_vertices), [&](auto const& vertex) {
-                 return vertex != pivot_from_1 && vertex != pivot_from_2 &&
-                        vertex != top && vertex != bottom;
-               });
-
-  // Check that there are exactly 2 new pivot vertices
-  if (new_pivot_vertices.size() != 2) { return std::nullopt; }
+  std::array<Vertex_handle_t<Triangulation>, 2> new_pivot_vertices;
+  std::size_t                  new_pivot_count = 0;
+  for (auto const& vertex : vertices.value())
+  {
+    if (vertex == pivot_from_1 || vertex == pivot_from_2 || vertex == top ||
+        vertex == bottom)
+    {
+      continue;
+    }
+    // Check that there are exactly 2 new pivot vertices
+    if (new_pivot_count == new_pivot_vertices.size())
+    {
+      return Plan{Flip_status::WRONG_PIVOT_VERTEX_COUNT};
+    }
+    new_pivot_vertices[new_pivot_count++] = vertex;
+  }
+  if (new_pivot_count != new_pivot_vertices.size())
+  {
+    return Plan{Flip_status::WRONG_PIVOT_VERTEX_COUNT};
+  }
 
   // Label the vertices in the new pivot edge
   auto const& pivot_to_1 = new_pivot_vertices[0];
   auto const& pivot_to_2 = new_pivot_vertices[1];
 
+  // If the new pivot edge is already in the triangulation, flipping would
+  // duplicate it and leave a non-manifold complex
+  if (has_edge(pivot_to_1, pivot_to_2))
+  {
+    return Plan{Flip_status::PIVOT_EDGE_EXISTS};
+  }
+
   // Now we need to classify the cells by the vertices they contain
-  Cell_handle before_1;  // top, pivot_from_1, pivot_from_2, pivot_to_1
-  Cell_handle before_2;  // top, pivot_from_1, pivot_from_2, pivot_to_2
-  Cell_handle before_3;  // bottom, pivot_from_1, pivot_from_2, pivot_to_1
-  Cell_handle before_4;  // bottom, pivot_from_1, pivot_from_2, pivot_to_2
+  // before_1: top, pivot_from_1, pivot_from_2, pivot_to_1
+  // before_2: top, pivot_from_1, pivot_from_2, pivot_to_2
+  // before_3: bottom, pivot_from_1, pivot_from_2, pivot_to_1
+  // before_4: bottom, pivot_from_1, pivot_from_2, pivot_to_2
+  Cell_handle_t<Triangulation> before_1;
+  Cell_handle_t<Triangulation> before_2;
+  Cell_handle_t<Triangulation> before_3;
+  Cell_handle_t<Triangulation> before_4;
   for (auto const& cell : incident_cells.value())
   {
+    // Top and bottom must be opposite each other around the pivot edge
+    if (cell->has_vertex(top) == cell->has_vertex(bottom))
+    {
+      return Plan{Flip_status::WRONG_PIVOT_VERTEX_COUNT};
+    }
     if (cell->has_vertex(top))
     {
       if (cell->has_vertex(pivot_to_1)) { before_1 = cell; }
@@ -249,123 +843,387 @@ inline void print_edge(Edge_handle const& edge)
     }
   }
 
-  // Verify these cells are valid
-  if (!before_1->is_valid() || !before_2->is_valid() || !before_3->is_valid() ||
-      !before_4->is_valid())
+  // Now find the exterior neighbors of the cells, and the index of each old
+  // cell in its exterior neighbor
+  auto const& tds = triangulation.tds();
+  auto const  exterior = [&tds](auto const& cell, auto const& opposite) {
+    auto const index = cell->index(opposite);
+    return std::pair{cell->neighbor(index), tds.mirror_index(cell, index)};
+  };
+  auto const [n_1, m_1] = exterior(before_1, pivot_from_2);
+  auto const [n_2, m_2] = exterior(before_1, pivot_from_1);
+  auto const [n_3, m_3] = exterior(before_2, pivot_from_1);
+  auto const [n_4, m_4] = exterior(before_2, pivot_from_2);
+  auto const [n_5, m_5] = exterior(before_3, pivot_from_2);
+  auto const [n_6, m_6] = exterior(before_3, pivot_from_1);
+  auto const [n_7, m_7] = exterior(before_4, pivot_from_1);
+  auto const [n_8, m_8] = exterior(before_4, pivot_from_2);
+
+  return Plan{
+      Flip_status::SUCCESS,
+      top,
+      bottom,
+      pivot_from_1,
+      pivot_from_2,
+      pivot_to_1,
+      pivot_to_2,
+      {before_1, before_2, before_3, before_4},
+      {n_1, n_2, n_3, n_4, n_5, n_6, n_7, n_8},
+      {m_1, m_2, m_3, m_4, m_5, m_6, m_7, m_8}
+  };
+}  // plan_flip_unrecorded()
+
+/// @brief Check a bistellar flip and gather what is needed to apply it
+/// @details The triangulation is not modified. A rejection is recorded
+/// here, and a successful plan's outcome by apply_flip().
+/// @param triangulation The triangulation to flip
+/// @param edge The edge to pivot on
+/// @param top Top vertex of the cells being flipped
+/// @param bottom Bottom vertex of the cells being flipped
+/// @return The plan, or the reason the flip would be rejected
+template <typename Triangulation>
+[[nodiscard]] auto plan_flip(
+    Triangulation const&                  triangulation,
+    Edge_handle_t<Triangulation> const&   edge,
+    Vertex_handle_t<Triangulation> const& top,
+    Vertex_handle_t<Triangulation> const& bottom)
+    -> Basic_flip_plan<Triangulation>
+{
+  auto plan = plan_flip_unrecorded(triangulation, edge, top, bottom);
+  if (!plan) { static_cast<void>(record_outcome(plan.status)); }
+  return plan;
+}  // plan_flip()
+
+/// @brief The orientations the 4 new cells of a planned flip would have
+/// @details Each new cell is an old cell with one pivot_from vertex replaced
+/// by a pivot_to vertex, in the same vertex order, as in apply_flip(). The 4
+/// orientations are evaluated in one filtered batch on the 6 points of the
+/// octahedral complex, without changing the triangulation.
+/// @param plan A successful plan from plan_flip()
+/// @return The orientation of after_1, after_2, after_3 and after_4
+template <typename Triangulation>
+[[nodiscard]] auto new_cell_orientations(
+    Basic_flip_plan<Triangulation> const& plan)
+    -> std::array<CGAL::Orientation, 4>
+{
+  using Triangulation_point = typename Triangulation::Point;
+  auto const tetrahedron    = [](auto const& cell, auto const& replaced,
+                              auto const& replacement) {
+    std::array<Triangulation_point, 4> points;
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const vertex = cell->vertex(i);
+      points[static_cast<std::size_t>(i)] =
+          (vertex == replaced ? replacement : vertex)->point();
+    }
+    return points;
+  };
+  auto const& [before_1, before_2, before_3, before_4] = plan.cells;
+  return batch_orientation(std::array{
+      tetrahedron(before_1, plan.pivot_from_2, plan.pivot_to_2),
+      tetrahedron(before_2, plan.pivot_from_1, plan.pivot_to_1),
+      tetrahedron(before_3, plan.pivot_from_2, plan.pivot_to_2),
+      tetrahedron(before_4, plan.pivot_from_1, plan.pivot_to_1)});
+}  // new_cell_orientations()
+
+/// @return True if every new cell of the planned flip would be positively
+/// oriented
+template <typename Triangulation>
+[[nodiscard]] auto is_geometrically_valid(
+    Basic_flip_plan<Triangulation> const& plan) -> bool
+{
+  auto const orientations = new_cell_orientations(plan);
+  return std::all_of(
+      orientations.begin(), orientations.end(),
+      [](auto orientation) { return orientation == CGAL::POSITIVE; });
+}  // is_geometrically_valid()
+
+/// @brief Rewrite the cells of a flip as they were before it
+/// @details The inverse of the rewiring done by apply_flip(): the old pivot
+/// edge is put back into the 4 cells, which are glued to each other and to
+/// their 8 exterior neighbors as recorded in the plan. Vertex order is kept,
+/// so a cell that was not reoriented by the flip comes back exactly as it
+/// was. Incident cells of the vertices and cell info are left to the caller.
+/// @param plan The plan the flip was applied from
+template <typename Triangulation>
+void restore_flip_cells(Basic_flip_plan<Triangulation> const& plan)
+{
+  auto const& [status, top, bottom, pivot_from_1, pivot_from_2, pivot_to_1,
+               pivot_to_2, before, neighbors, mirrors] = plan;
+  auto const& [before_1, before_2, before_3, before_4] = before;
+  auto const& [n_1, n_2, n_3, n_4, n_5, n_6, n_7, n_8] = neighbors;
+  auto const& [m_1, m_2, m_3, m_4, m_5, m_6, m_7, m_8] = mirrors;
+
+  // Put the old pivot edge back
+  // before_1: top, pivot_from_1, pivot_from_2, pivot_to_1
+  // before_2: top, pivot_from_1, pivot_from_2, pivot_to_2
+  // before_3: bottom, pivot_from_1, pivot_from_2, pivot_to_1
+  // before_4: bottom, pivot_from_1, pivot_from_2, pivot_to_2
+  before_1->set_vertex(before_1->index(pivot_to_2), pivot_from_2);
+  before_2->set_vertex(before_2->index(pivot_to_1), pivot_from_1);
+  before_3->set_vertex(before_3->index(pivot_to_2), pivot_from_2);
+  before_4->set_vertex(before_4->index(pivot_to_1), pivot_from_1);
+
+  // Restore the neighbors of the old cells; neighbor i is opposite vertex i
+  before_1->set_neighbor(before_1->index(pivot_from_2), n_1);
+  before_1->set_neighbor(before_1->index(pivot_from_1), n_2);
+  before_1->set_neighbor(before_1->index(pivot_to_1), before_2);
+  before_1->set_neighbor(before_1->index(top), before_3);
+
+  before_2->set_neighbor(before_2->index(pivot_from_1), n_3);
+  before_2->set_neighbor(before_2->index(pivot_from_2), n_4);
+  before_2->set_neighbor(before_2->index(pivot_to_2), before_1);
+  before_2->set_neighbor(before_2->index(top), before_4);
+
+  before_3->set_neighbor(before_3->index(pivot_from_2), n_5);
+  before_3->set_neighbor(before_3->index(pivot_from_1), n_6);
+  before_3->set_neighbor(before_3->index(pivot_to_1), before_4);
+  before_3->set_neighbor(before_3->index(bottom), before_1);
+
+  before_4->set_neighbor(before_4->index(pivot_from_1), n_7);
+  before_4->set_neighbor(before_4->index(pivot_from_2), n_8);
+  before_4->set_neighbor(before_4->index(pivot_to_2), before_3);
+  before_4->set_neighbor(before_4->index(bottom), before_2);
+
+  // Only these exterior neighbors were pointed at a different cell
+  n_2->set_neighbor(m_2, before_1);
+  n_4->set_neighbor(m_4, before_2);
+  n_6->set_neighbor(m_6, before_3);
+  n_8->set_neighbor(m_8, before_4);
+}  // restore_flip_cells()
+
+/// @brief Apply a planned bistellar flip to the triangulation
+/// @details The 4 old cells are rewritten in place as the 4 new cells, so no
+/// cell is deleted or created. The cell container does not churn, its size
+/// and free list never change, and the new cells stay in the memory of the
+/// cells they replace. Flips of octahedral complexes that share no vertex
+/// write to disjoint memory and can be applied concurrently. A flip that
+/// fails validation after the cells were rewritten is rolled back, so a
+/// rejected flip never changes the triangulation.
+/// @param triangulation The triangulation to flip
+/// @param plan A successful plan from plan_flip() for this triangulation
+/// @param validation Whether to check only the octahedral complex, or the
+/// whole triangulation as well, or the geometry of the new cells first
+/// @return The new cells and pivot edge, or the reason the flip was rejected
+template <typename Triangulation>
+[[nodiscard]] auto apply_flip(
+    Triangulation& triangulation, Basic_flip_plan<Triangulation> const& plan,
+    Flip_validation validation = Flip_validation::LOCAL)
+    -> Basic_flip_result<Triangulation>
+{
+  using Result = Basic_flip_result<Triangulation>;
+
+  if (!plan) { return Result{plan.status}; }
+
+  // Reject flips that would invert a cell while nothing has been touched
+  if (validation == Flip_validation::GEOMETRIC)
   {
-    return std::nullopt;
+    Stage_timer check(Flip_stage::VALIDATION);
+    if (!is_geometrically_valid(plan))
+    {
+      return Result{record_outcome(Flip_status::INVERTED_CELL)};
+    }
+  }
+
+  auto const& [status, top, bottom, pivot_from_1, pivot_from_2, pivot_to_1,
+               pivot_to_2, before, neighbors, mirrors] = plan;
+  auto const& [n_1, n_2, n_3, n_4, n_5, n_6, n_7, n_8]  = neighbors;
+  auto const& [m_1, m_2, m_3, m_4, m_5, m_6, m_7, m_8]  = mirrors;
+
+  // Reuse the old cells: each keeps the exterior facet it shares with its
+  // neighbors and has its other pivot_from vertex replaced. Vertex order is
+  // kept, so orientation is preserved without reorient()
+  // after_1: top, pivot_from_1, pivot_to_1, pivot_to_2
+  // after_2: top, pivot_from_2, pivot_to_1, pivot_to_2
+  // after_3: bottom, pivot_from_1, pivot_to_1, pivot_to_2
+  // after_4: bottom, pivot_from_2, pivot_to_1, pivot_to_2
+  auto const& [after_1, after_2, after_3, after_4] = before;
+  Stage_timer timer(Flip_stage::CELL_CREATION);
+
+  // Kept so that a flip failing validation can be rolled back
+  auto const vertices = plan.vertices();
+  std::array<Cell_handle_t<Triangulation>, 6> vertex_cells;
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    vertex_cells[i] = vertices[i]->cell();
+  }
+
+  after_1->set_vertex(after_1->index(pivot_from_2), pivot_to_2);
+  after_2->set_vertex(after_2->index(pivot_from_1), pivot_to_1);
+  after_3->set_vertex(after_3->index(pivot_from_2), pivot_to_2);
+  after_4->set_vertex(after_4->index(pivot_from_1), pivot_to_1);
+
+  // Now set the neighbors of the new cells; neighbor i is opposite vertex i
+  timer.next(Flip_stage::NEIGHBOR_WIRING);
+  after_1->set_neighbor(after_1->index(pivot_to_2), n_1);
+  after_1->set_neighbor(after_1->index(pivot_to_1), n_4);
+  after_1->set_neighbor(after_1->index(pivot_from_1), after_2);
+  after_1->set_neighbor(after_1->index(top), after_3);
+
+  after_2->set_neighbor(after_2->index(pivot_to_2), n_2);
+  after_2->set_neighbor(after_2->index(pivot_to_1), n_3);
+  after_2->set_neighbor(after_2->index(pivot_from_2), after_1);
+  after_2->set_neighbor(after_2->index(top), after_4);
+
+  after_3->set_neighbor(after_3->index(pivot_to_2), n_5);
+  after_3->set_neighbor(after_3->index(pivot_to_1), n_8);
+  after_3->set_neighbor(after_3->index(pivot_from_1), after_4);
+  after_3->set_neighbor(after_3->index(bottom), after_1);
+
+  after_4->set_neighbor(after_4->index(pivot_to_2), n_6);
+  after_4->set_neighbor(after_4->index(pivot_to_1), n_7);
+  after_4->set_neighbor(after_4->index(pivot_from_2), after_3);
+  after_4->set_neighbor(after_4->index(bottom), after_2);
+
+  // Now set the neighboring cells to the new cells. n_1, n_3, n_5 and n_7
+  // already point at the cell that was reused for their new neighbor
+  n_2->set_neighbor(m_2, after_2);
+  n_4->set_neighbor(m_4, after_1);
+  n_6->set_neighbor(m_6, after_4);
+  n_8->set_neighbor(m_8, after_3);
+
+  // The old cells may have been the incident cells of the 6 vertices
+  top->set_cell(after_1);
+  bottom->set_cell(after_3);
+  pivot_from_1->set_cell(after_1);
+  pivot_from_2->set_cell(after_2);
+  pivot_to_1->set_cell(after_1);
+  pivot_to_2->set_cell(after_1);
+
+  // Fix any cell orientation issues and check only the octahedral complex
+  timer.next(Flip_stage::VALIDATION);
+  std::array<Cell_handle_t<Triangulation>, 4> const after{after_1, after_2,
+                                                          after_3, after_4};
+  auto const reoriented = reorient_locally(after);
+
+  // The global check walks every cell, so it is opt-in
+  if (!is_locally_valid(triangulation, after) ||
+      (validation == Flip_validation::GLOBAL &&
+       !triangulation.tds().is_valid(true, 1)))
+  {
+    // Roll back, so that a rejected flip leaves nothing changed
+    for (std::size_t i = 0; i < after.size(); ++i)
+    {
+      if ((reoriented & (1U << i)) != 0) { change_orientation(after[i]); }
+    }
+    restore_flip_cells(plan);
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+      vertices[i]->set_cell(vertex_cells[i]);
+    }
+    return Result{record_outcome(Flip_status::INVALID_CELL)};
   }
 
-#ifndef NDEBUG
-  fmt::print("Cells in the triangulation before deleting old cells: {}\n",
-             triangulation.number_of_cells());
-#endif
-
-  // Now find the exterior neighbors of the cells
-  Cell_handle n_1 = before_1->neighbor(before_1->index(pivot_from_2));
-  Cell_handle n_2 = before_1->neighbor(before_1->index(pivot_from_1));
-  Cell_handle n_3 = before_2->neighbor(before_2->index(pivot_from_1));
-  Cell_handle n_4 = before_2->neighbor(before_2->index(pivot_from_2));
-  Cell_handle n_5 = before_3->neighbor(before_3->index(pivot_from_2));
-  Cell_handle n_6 = before_3->neighbor(before_3->index(pivot_from_1));
-  Cell_handle n_7 = before_4->neighbor(before_4->index(pivot_from_1));
-  Cell_handle n_8 = before_4->neighbor(before_4->index(pivot_from_2));
-
-  // Next, delete the old cells
-  triangulation.tds().delete_cell(before_1);
-  triangulation.tds().delete_cell(before_2);
-  triangulation.tds().delete_cell(before_3);
-  triangulation.tds().delete_cell(before_4);
-
-#ifndef NDEBUG
-  fmt::print("Cells in the triangulation after deleting old cells: {}\n",
-             triangulation.number_of_cells());
-#endif
-
-  // Now create the new cells
-  Cell_handle after_1 = triangulation.tds().create_cell(top, pivot_from_1,
-                                                        pivot_to_1, pivot_to_2);
-  Cell_handle after_2 = triangulation.tds().create_cell(top, pivot_from_2,
-                                                        pivot_to_1, pivot_to_2);
-  Cell_handle after_3 = triangulation.tds().create_cell(bottom, pivot_from_1,
-                                                        pivot_to_1, pivot_to_2);
-  Cell_handle after_4 = triangulation.tds().create_cell(bottom, pivot_from_2,
-                                                        pivot_to_1, pivot_to_2);
-
-  // Now set the neighbors of the new cells
-  after_1->set_neighbors(n_1, n_4, after_2, after_3);
-  after_2->set_neighbors(n_2, n_3, after_1, after_4);
-  after_3->set_neighbors(n_5, n_8, after_4, after_1);
-  after_4->set_neighbors(n_6, n_7, after_2, after_3);
-
-  // Now set the neighboring cells to the new cells
-  //  n_1->set_neighbor(n_1->index(triangulation.tds().mirror_vertex(
-  //                        after_1, after_1->index(pivot_to_2))),
-  //                    after_1);
-  //  n_2->set_neighbor(n_2->index(triangulation.tds().mirror_vertex(
-  //                        after_2, after_2->index(pivot_to_2))),
-  //                    after_2);
-  //  n_3->set_neighbor(n_3->index(triangulation.tds().mirror_vertex(
-  //                        after_2, after_2->index(pivot_to_1))),
-  //                    after_2);
-  //  n_4->set_neighbor(n_4->index(triangulation.tds().mirror_vertex(
-  //                        after_1, after_1->index(pivot_to_1))),
-  //                    after_1);
-  //  n_5->set_neighbor(n_5->index(triangulation.tds().mirror_vertex(
-  //                        after_3, after_3->index(pivot_to_2))),
-  //                    after_3);
-  //  n_6->set_neighbor(n_6->index(triangulation.tds().mirror_vertex(
-  //                        after_4, after_4->index(pivot_to_2))),
-  //                    after_4);
-  //  n_7->set_neighbor(n_7->index(triangulation.tds().mirror_vertex(
-  //                        after_4, after_4->index(pivot_to_1))),
-  //                    after_4);
-  //  n_8->set_neighbor(n_8->index(triangulation.tds().mirror_vertex(
-  //                        after_3, after_3->index(pivot_to_1))),
-  //                    after_3);
-
-  // Alternative way to set the neighbors
-  //  auto mirror_index = triangulation.tds().mirror_index(before_1,
-  //  before_1->index(pivot_from_2)); n_1->set_neighbor(mirror_index, after_1);
-  //  n_1->set_neighbor(triangulation.tds().mirror_index(before_1,
-  //  before_1->index(pivot_from_2)), after_1);
-  //  n_2->set_neighbor(triangulation.tds().mirror_index(before_1,
-  //  before_1->index(pivot_from_1)), after_2);
-  //  n_3->set_neighbor(triangulation.tds().mirror_index(before_2,
-  //  before_2->index(pivot_from_1)), after_2);
-  //  n_4->set_neighbor(triangulation.tds().mirror_index(before_2,
-  //  before_2->index(pivot_from_2)), after_1);
-  //  n_5->set_neighbor(triangulation.tds().mirror_index(before_3,
-  //  before_3->index(pivot_from_2)), after_3);
-  //  n_6->set_neighbor(triangulation.tds().mirror_index(before_3,
-  //  before_3->index(pivot_from_1)), after_4);
-  //  n_7->set_neighbor(triangulation.tds().mirror_index(before_4,
-  //  before_4->index(pivot_from_1)), after_4);
-  //  n_8->set_neighbor(triangulation.tds().mirror_index(before_4,
-  //  before_4->index(pivot_from_2)), after_3);
-
-  // Okay, we'll need to test each before and after cell to see if we
-  // get the n_x's right
-
-#ifndef NDEBUG
-  fmt::print("Cells in the triangulation after adding new cells: {}\n",
-             triangulation.number_of_cells());
-#endif
-
-  // Fix any cell orientation issues
-  if (!triangulation.is_valid()) { triangulation.tds().reorient(); }
-
-#ifndef NDEBUG
-  triangulation.tds().is_valid(true, 1);
-#endif
-
-  // Check validity of cells
-  if (after_1->is_valid() && after_2->is_valid() && after_3->is_valid() &&
-      after_4->is_valid())
-  {
-    return std::make_optional(triangulation);
-  }
-  else { return std::nullopt; }
+  // A created cell would have default info, so match that
+  if constexpr (Has_info<typename Triangulation::Cell>)
+  {
+    for (auto const& cell : after) { cell->info() = {}; }
+  }
+
+  return Result{
+      record_outcome(Flip_status::SUCCESS), after,
+      Edge_handle_t<Triangulation>{after_1, after_1->index(pivot_to_1),
+                                   after_1->index(pivot_to_2)}
+  };
+}  // apply_flip()
+
+/// @brief Perform an in-place bistellar flip on triangulation via the given
+/// edge
+/// @details Only the 4 cells incident to the pivot edge and their 8 exterior
+/// neighbors are touched, so the cost of a flip does not depend on the size
+/// of the triangulation.
+/// @param triangulation The triangulation to flip
+/// @param edge The edge to pivot on
+/// @param top Top vertex of the cells being flipped
+/// @param bottom Bottom vertex of the cells being flipped
+/// @param validation Whether to check only the octahedral complex, or the
+/// whole triangulation as well, or the geometry of the new cells first
+/// @return The new cells and pivot edge, or the reason the flip was rejected
+template <typename Triangulation>
+[[nodiscard]] auto bistellar_flip(
+    Triangulation& triangulation, Edge_handle_t<Triangulation> const& edge,
+    Vertex_handle_t<Triangulation> const& top,
+    Vertex_handle_t<Triangulation> const& bottom,
+    Flip_validation validation = Flip_validation::LOCAL)
+    -> Basic_flip_result<Triangulation>
+{
+  return apply_flip(triangulation, plan_flip(triangulation, edge, top, bottom),
+                    validation);
+}  // bistellar_flip
+
+/// @brief Plan a bistellar flip for each choice of top and bottom vertices
+/// @details The choices are the 2 ring diagonals from
+/// get_octahedron_diagonals(); plan i puts top and bottom on ring diagonal
+/// i + 1 and would make the other ring diagonal the pivot edge. The
+/// triangulation is not modified, so the caller may apply either plan.
+/// No outcome is recorded: apply_flip() records that of the plan applied,
+/// and record_outcome() that of a rejected plan chosen instead.
+/// @param triangulation The triangulation to flip
+/// @param edge The edge to pivot on
+/// @return The 2 plans, both rejected with the same status if the edge is
+/// not a pivot edge
+template <typename Triangulation>
+[[nodiscard]] auto plan_flips(Triangulation const&                triangulation,
+                              Edge_handle_t<Triangulation> const& edge)
+    -> std::array<Basic_flip_plan<Triangulation>, 2>
+{
+  using Plan = Basic_flip_plan<Triangulation>;
+
+  if (!triangulation.tds().is_valid(edge.first, edge.second, edge.third))
+  {
+    return {Plan{Flip_status::INVALID_EDGE}, Plan{Flip_status::INVALID_EDGE}};
+  }
+  auto const diagonals = get_octahedron_diagonals(triangulation, edge);
+  if (!diagonals)
+  {
+    return {Plan{Flip_status::WRONG_VALENCE},
+            Plan{Flip_status::WRONG_VALENCE}};
+  }
+  auto const& [pivot, first, second] = *diagonals;
+  return {
+      plan_flip_unrecorded(triangulation, edge, first.first, first.second),
+      plan_flip_unrecorded(triangulation, edge, second.first, second.second)};
+}  // plan_flips()
+
+/// @brief Perform an in-place bistellar flip, choosing the top and bottom
+/// vertices from the octahedron around the edge
+/// @details Each ring diagonal is tried in turn as top and bottom, and the
+/// first that can be flipped is; with Flip_validation::GEOMETRIC, that
+/// includes keeping every new cell positively oriented. Unlike passing top
+/// and bottom, this needs no vertex handles from the caller.
+/// @param triangulation The triangulation to flip
+/// @param edge The edge to pivot on
+/// @param validation Whether to check only the octahedral complex, or the
+/// whole triangulation as well, or the geometry of the new cells first
+/// @return The new cells and pivot edge, or the reason the last choice
+/// was rejected
+template <typename Triangulation>
+[[nodiscard]] auto bistellar_flip(
+    Triangulation& triangulation, Edge_handle_t<Triangulation> const& edge,
+    Flip_validation validation = Flip_validation::LOCAL)
+    -> Basic_flip_result<Triangulation>
+{
+  using Result = Basic_flip_result<Triangulation>;
+
+  if (!triangulation.tds().is_valid(edge.first, edge.second, edge.third))
+  {
+    return Result{record_outcome(Flip_status::INVALID_EDGE)};
+  }
+  auto const diagonals = get_octahedron_diagonals(triangulation, edge);
+  if (!diagonals) { return Result{record_outcome(Flip_status::WRONG_VALENCE)}; }
+  // Plan both choices, but record only the outcome of the one returned
+  auto const& [pivot, first, second] = *diagonals;
+  auto plan =
+      plan_flip_unrecorded(triangulation, edge, first.first, first.second);
+  if (!plan || (validation == Flip_validation::GEOMETRIC &&
+                !is_geometrically_valid(plan)))
+  {
+    auto other =
+        plan_flip_unrecorded(triangulation, edge, second.first, second.second);
+    if (other || !plan) { plan = other; }
+  }
+  if (!plan) { return Result{record_outcome(plan.status)}; }
+  return apply_flip(triangulation, plan, validation);
 }  // bistellar_flip
 
 #endif  // BISTELLAR_FLIP_BISTELLAR_FLIP_HPP
@@ -0,0 +1,310 @@
+/// @file delaunay_repair.hpp
+/// @brief Track and restore the Delaunay property with local work
+/// @author Adam Getchell
+/// @details A triangulation is Delaunay if and only if every facet is locally
+/// Delaunay, i.e. the vertex across each facet is not inside the circumsphere
+/// of the cell. A move only changes the facets of its new cells, so after a
+/// move only those cells need to be checked. Delaunay_repair keeps a queue
+/// of such dirty cells, reports which of them are not locally Delaunay, and
+/// restores the Delaunay property by Lawson flips: 2-3 and 3-2 moves on the
+/// offending facets, queueing the new cells of each move in turn.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_DELAUNAY_REPAIR_HPP
+#define BISTELLAR_FLIP_DELAUNAY_REPAIR_HPP
+
+#include <CGAL/enum.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <ranges>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "pachner_moves.hpp"
+
+/// @brief Check whether a facet is locally Delaunay
+/// @details Facets on the convex hull have no vertex across them and are
+/// always locally Delaunay. Cospherical vertices are not inside the sphere,
+/// so degenerate facets count as locally Delaunay.
+/// @param triangulation The triangulation containing the cell
+/// @param cell The cell
+/// @param index The index of the facet, opposite vertex index
+/// @return True if the vertex across the facet is not inside the
+/// circumsphere of the cell
+template <typename Triangulation>
+[[nodiscard]] auto is_locally_delaunay(
+    Triangulation const& triangulation,
+    Cell_handle_t<Triangulation> const& cell, int index) -> bool
+{
+  if (triangulation.is_infinite(cell) ||
+      triangulation.is_infinite(cell->neighbor(index)))
+  {
+    return true;
+  }
+  auto const opposite = triangulation.mirror_vertex(cell, index);
+  return triangulation.side_of_sphere(cell, opposite->point()) !=
+         CGAL::ON_BOUNDED_SIDE;
+}  // is_locally_delaunay()
+
+/// @return True if all 4 facets of the cell are locally Delaunay
+template <typename Triangulation>
+[[nodiscard]] auto is_locally_delaunay(
+    Triangulation const& triangulation,
+    Cell_handle_t<Triangulation> const& cell) -> bool
+{
+  for (int i = 0; i < 4; ++i)
+  {
+    if (!is_locally_delaunay(triangulation, cell, i)) { return false; }
+  }
+  return true;
+}  // is_locally_delaunay()
+
+/// @brief What a pass restoring the Delaunay property did
+struct Delaunay_repair_report
+{
+  /// Dirty cells whose facets were checked
+  std::size_t checked{};
+  std::size_t two_three_moves{};
+  std::size_t three_two_moves{};
+  /// Dirty cells left with a facet that could not be flipped
+  std::size_t remaining{};
+
+  /// @return The number of moves made
+  [[nodiscard]] auto moves() const -> std::size_t
+  {
+    return two_three_moves + three_two_moves;
+  }
+};
+
+/// @brief A queue of cells that may not be locally Delaunay
+/// @details Mark the new cells of every move made to a Delaunay
+/// triangulation. Cells deleted by a move must be forgotten. Checking and
+/// restoring then visit only the marked cells and the cells created while
+/// restoring, never the whole triangulation.
+template <typename Triangulation>
+class Basic_delaunay_repair
+{
+ public:
+  using Cell_handle_type   = Cell_handle_t<Triangulation>;
+  using Edge_handle_type   = Edge_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Move_result_type   = Basic_move_result<Triangulation>;
+
+  /// @param triangulation The triangulation; must outlive the queue
+  explicit Basic_delaunay_repair(Triangulation& triangulation)
+      : m_triangulation{triangulation}
+  {}
+
+  /// @brief Queue a cell whose facets may no longer be locally Delaunay
+  void mark(Cell_handle_type const& cell)
+  {
+    m_stuck.erase(cell);
+    if (m_dirty.insert(cell).second) { m_queue.emplace_back(cell); }
+  }
+
+  /// @brief Queue the new cells of a move
+  template <std::ranges::input_range Range>
+  void mark(Range const& cells)
+  {
+    for (auto const& cell : cells) { mark(cell); }
+  }
+
+  /// @brief Queue every finite cell, e.g. for a triangulation that may not
+  /// be Delaunay to begin with. This is the only O(N) operation.
+  void mark_all()
+  {
+    for (auto const& cell : finite_cells_view(m_triangulation)) { mark(cell); }
+  }
+
+  /// @brief Remove a cell that was deleted from the triangulation
+  void forget(Cell_handle_type const& cell)
+  {
+    m_dirty.erase(cell);
+    m_stuck.erase(cell);
+  }
+
+  /// @return The number of queued cells
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_dirty.size();
+  }
+
+  /// @return True if no cells are queued
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_dirty.empty(); }
+
+  /// @brief Drop the queued cells that are locally Delaunay
+  /// @return The number of queued cells with a facet that is not
+  auto check() -> std::size_t
+  {
+    std::deque<Cell_handle_type> remaining;
+    for (auto const& cell : m_queue)
+    {
+      // Skip duplicates and forgotten cells
+      if (m_dirty.erase(cell) == 0) { continue; }
+      if (!is_locally_delaunay(m_triangulation, cell))
+      {
+        remaining.emplace_back(cell);
+      }
+    }
+    m_dirty.insert(remaining.begin(), remaining.end());
+    m_queue = std::move(remaining);
+    return m_queue.size();
+  }
+
+  /// @return True if every queued cell is locally Delaunay, and therefore,
+  /// if all moves since the triangulation was Delaunay were marked, the
+  /// triangulation is Delaunay
+  [[nodiscard]] auto is_delaunay() -> bool { return check() == 0; }
+
+  /// @brief Flip facets of queued cells until each is locally Delaunay
+  /// @details A facet that is not locally Delaunay is removed by a 2-3 move
+  /// if the segment joining the vertices on either side crosses it, or by a
+  /// 3-2 move on the edge the segment passes beyond if that edge has 3
+  /// incident cells. Otherwise the cell stays queued until a later move
+  /// changes it. Each move lowers the lifted volume of the triangulation,
+  /// so this terminates. The moves are chosen by the geometry, so every
+  /// finite cell must be positively oriented; bistellar flips only check
+  /// the combinatorics, and a flip of a non-convex octahedron inverts cells
+  /// that no Lawson flip can fix.
+  /// @param visitor Called after each move with the result and the
+  /// endpoints of the edge created by a 2-3 move or removed by a 3-2 move
+  /// @return What was done
+  template <typename Visitor>
+  auto restore(Visitor&& visitor) -> Delaunay_repair_report
+  {
+    Delaunay_repair_report report;
+    std::size_t            moves = 0;
+    do {
+      moves = report.moves();
+      while (!m_queue.empty())
+      {
+        auto const cell = m_queue.front();
+        m_queue.pop_front();
+        if (m_dirty.erase(cell) == 0) { continue; }
+        ++report.checked;
+
+        bool violated = false;
+        for (int i = 0; i < 4; ++i)
+        {
+          if (is_locally_delaunay(m_triangulation, cell, i)) { continue; }
+          violated = true;
+          if (auto const result = flip_facet(cell, i, visitor))
+          {
+            if (result->type == Move_type::TWO_THREE)
+            {
+              ++report.two_three_moves;
+            }
+            else { ++report.three_two_moves; }
+            violated = false;
+            break;
+          }
+        }
+        if (violated) { m_stuck.insert(cell); }
+      }
+
+      // Moves elsewhere may have made the stuck cells flippable, so retry
+      // them until a pass makes no progress; check() then reports them
+      for (auto const& cell : m_stuck)
+      {
+        m_dirty.insert(cell);
+        m_queue.emplace_back(cell);
+      }
+      m_stuck.clear();
+    }
+    while (report.moves() > moves);
+    report.remaining = m_queue.size();
+    return report;
+  }
+
+  /// @brief Flip facets of queued cells until each is locally Delaunay
+  auto restore() -> Delaunay_repair_report
+  {
+    return restore([](Move_result_type const&, Vertex_handle_type const&,
+                      Vertex_handle_type const&) {});
+  }
+
+ private:
+  /// @brief Flip a facet that is not locally Delaunay, if it can be
+  /// @return The result of the move, or std::nullopt
+  template <typename Visitor>
+  auto flip_facet(Cell_handle_type const& cell, int index, Visitor& visitor)
+      -> std::optional<Move_result_type>
+  {
+    auto const top    = cell->vertex(index);
+    auto const bottom = m_triangulation.mirror_vertex(cell, index);
+
+    // Which way the segment from top to bottom winds around each edge of
+    // the facet; it crosses the facet if it winds the same way around all 3
+    std::array<Vertex_handle_type, 3> facet;
+    std::array<CGAL::Orientation, 3>  sides{};
+    for (int k = 0; k < 3; ++k)
+    {
+      facet[static_cast<std::size_t>(k)] = cell->vertex((index + 1 + k) & 3);
+    }
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      sides[k] = CGAL::orientation(top->point(), bottom->point(),
+                                   facet[k]->point(),
+                                   facet[(k + 1) % 3]->point());
+      if (sides[k] == CGAL::COPLANAR) { return std::nullopt; }
+    }
+
+    if (sides[0] == sides[1] && sides[1] == sides[2])
+    {
+      auto result = two_three_move(m_triangulation, cell, index);
+      if (!result) { return std::nullopt; }
+      visitor(result, top, bottom);
+      mark(result.cells);
+      return result;
+    }
+
+    // The segment passes beyond the edge around which it winds the other
+    // way; removing that edge needs exactly 3 cells around it
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      if (sides[k] == sides[(k + 1) % 3] || sides[k] == sides[(k + 2) % 3])
+      {
+        continue;
+      }
+      auto const& first  = facet[k];
+      auto const& second = facet[(k + 1) % 3];
+      // The third cell around the edge shares the facet top, first, second
+      auto const third = cell->neighbor(cell->index(facet[(k + 2) % 3]));
+      std::array<Cell_handle_type, 3> const before{
+          cell, cell->neighbor(index), third};
+      auto result = three_two_move(
+          m_triangulation,
+          Edge_handle_type{cell, cell->index(first), cell->index(second)});
+      if (!result) { return std::nullopt; }
+      for (auto const& old : before)
+      {
+        if (std::find(result.cells.begin(), result.cells.end(), old) ==
+            result.cells.end())
+        {
+          forget(old);
+        }
+      }
+      visitor(result, first, second);
+      mark(result.cells);
+      return result;
+    }
+    return std::nullopt;
+  }
+
+  Triangulation&                       m_triangulation;
+  std::deque<Cell_handle_type>         m_queue;
+  /// The queued cells; m_queue may also hold duplicates and deleted cells
+  std::unordered_set<Cell_handle_type> m_dirty;
+  /// Cells found not locally Delaunay that could not be flipped yet
+  std::unordered_set<Cell_handle_type> m_stuck;
+};
+
+using Delaunay_repair = Basic_delaunay_repair<Delaunay>;
+
+#endif  // BISTELLAR_FLIP_DELAUNAY_REPAIR_HPP
@@ -0,0 +1,147 @@
+/// @file epoch_snapshot.hpp
+/// @brief Publish snapshots of a triangulation to analysis threads
+/// @author Adam Getchell
+/// @details bistellar_flip() rewrites cells in place, so anything that walks
+/// the triangulation must run while flipping is paused. Instead, the flip
+/// thread publishes an Soa_snapshot every so often, numbered by an epoch,
+/// and analysis threads measure the latest one while flipping continues.
+/// Snapshot buffers are recycled: when the last reader of a retired snapshot
+/// releases it, the buffer is handed back to the publisher under a lock, and
+/// the next publish refills it, reusing its arrays. A reader's snapshot is
+/// never modified, however long it is held.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_EPOCH_SNAPSHOT_HPP
+#define BISTELLAR_FLIP_EPOCH_SNAPSHOT_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "soa_snapshot.hpp"
+
+/// @brief A snapshot of a triangulation at some epoch
+struct Epoch_snapshot
+{
+  /// Numbered from 1 in order of publication
+  std::uint64_t epoch{};
+  /// Successful flips made before the snapshot was taken, as given to
+  /// Snapshot_publisher::publish()
+  std::size_t   flips{};
+  Soa_snapshot  snapshot;
+  /// Scratch space of the publisher, reused with the buffer
+  Soa_numbering numbering;
+};
+
+/// @brief Hands consistent snapshots from one flip thread to any number of
+/// analysis threads
+/// @details publish() is called by the thread that flips, between flips;
+/// latest(), wait_newer() and close() may be called from any thread. The
+/// lock is held only to swap pointers, never while copying.
+class Snapshot_publisher
+{
+ public:
+  using Snapshot_pointer = std::shared_ptr<Epoch_snapshot const>;
+
+  /// @brief Copy the triangulation and make it the latest snapshot
+  /// @details The copy is made outside the lock, so readers are not
+  /// blocked by it.
+  /// @param triangulation A 3-dimensional triangulation, not being flipped
+  /// @param flips The number of flips made so far, recorded in the snapshot
+  /// @return The epoch of the new snapshot
+  template <typename Triangulation>
+  auto publish(Triangulation const& triangulation, std::size_t flips = 0)
+      -> std::uint64_t
+  {
+    std::unique_ptr<Epoch_snapshot> buffer;
+    {
+      std::lock_guard const lock(m_recycler->mutex);
+      if (!m_recycler->buffers.empty())
+      {
+        buffer = std::move(m_recycler->buffers.back());
+        m_recycler->buffers.pop_back();
+      }
+    }
+    if (!buffer) { buffer = std::make_unique<Epoch_snapshot>(); }
+    fill_soa_snapshot(triangulation, buffer->snapshot, buffer->numbering);
+    buffer->flips = flips;
+    // Only publish() writes the epoch, so it can be read without the lock
+    buffer->epoch = m_epoch + 1;
+
+    // The last owner of the snapshot, reader or publisher, hands it back
+    Snapshot_pointer snapshot(
+        buffer.release(), [recycler = m_recycler](Epoch_snapshot* released) {
+          std::lock_guard const lock(recycler->mutex);
+          recycler->buffers.emplace_back(released);
+        });
+    auto const       epoch = snapshot->epoch;
+    Snapshot_pointer retired;
+    {
+      std::lock_guard const lock(m_mutex);
+      retired = std::exchange(m_current, std::move(snapshot));
+      m_epoch = epoch;
+    }
+    // Any hand-back of the retired snapshot happens outside the lock
+    retired.reset();
+    m_published.notify_all();
+    return epoch;
+  }
+
+  /// @return The latest snapshot, or nullptr if none has been published
+  [[nodiscard]] auto latest() const -> Snapshot_pointer
+  {
+    std::lock_guard const lock(m_mutex);
+    return m_current;
+  }
+
+  /// @brief Wait for a snapshot newer than the given epoch
+  /// @param epoch The epoch of the last snapshot seen, or 0 for any
+  /// @return The latest snapshot, or nullptr if the publisher was closed
+  /// with no newer snapshot
+  [[nodiscard]] auto wait_newer(std::uint64_t epoch) const -> Snapshot_pointer
+  {
+    std::unique_lock lock(m_mutex);
+    m_published.wait(lock, [&] { return m_epoch > epoch || m_closed; });
+    if (m_epoch > epoch) { return m_current; }
+    return nullptr;
+  }
+
+  /// @brief Tell waiting readers that nothing more will be published
+  void close()
+  {
+    {
+      std::lock_guard const lock(m_mutex);
+      m_closed = true;
+    }
+    m_published.notify_all();
+  }
+
+  /// @return The epoch of the latest snapshot, or 0 if none
+  [[nodiscard]] auto epoch() const -> std::uint64_t
+  {
+    std::lock_guard const lock(m_mutex);
+    return m_epoch;
+  }
+
+ private:
+  /// Buffers that no reader holds, handed back when the last one is
+  /// released. Shared with the snapshots, which may outlive the publisher
+  struct Recycler
+  {
+    std::mutex                                   mutex;
+    std::vector<std::unique_ptr<Epoch_snapshot>> buffers;
+  };
+
+  mutable std::mutex              m_mutex;
+  mutable std::condition_variable m_published;
+  Snapshot_pointer                m_current;
+  std::uint64_t                   m_epoch{};
+  bool                            m_closed{};
+  std::shared_ptr<Recycler>       m_recycler{std::make_shared<Recycler>()};
+};
+
+#endif  // BISTELLAR_FLIP_EPOCH_SNAPSHOT_HPP
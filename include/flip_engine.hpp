@@ -0,0 +1,400 @@
+/// @file flip_engine.hpp
+/// @brief Apply bistellar flips in batches and report throughput
+/// @author Adam Getchell
+/// @details Draws candidate pivot edges from a Pivot_edge_index into a work
+/// queue, chooses top and bottom vertices from the incident cells, and
+/// applies bistellar_flip back to back until a target number of flips or a
+/// time budget is reached.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_FLIP_ENGINE_HPP
+#define BISTELLAR_FLIP_FLIP_ENGINE_HPP
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <random>
+#include <utility>
+
+#include "bistellar_flip.hpp"
+#include "delaunay_repair.hpp"
+#include "epoch_snapshot.hpp"
+#include "pivot_edge_index.hpp"
+#include "relayout.hpp"
+#include "star_cache.hpp"
+
+/// @brief When to stop a batch of flips
+struct Flip_engine_options
+{
+  /// Stop after this many successful flips
+  std::size_t target_flips{1000};
+  /// Stop after this much wall-clock time, whichever comes first
+  std::chrono::nanoseconds time_budget{std::chrono::nanoseconds::max()};
+  /// Stop after this many rejections in a row
+  std::size_t max_consecutive_rejections{10000};
+  /// How many candidate edges to draw into the queue at a time
+  std::size_t batch_size{64};
+  /// Reorder storage along a Hilbert curve after every this many
+  /// successful flips, or never if 0; see relayout()
+  std::size_t relayout_interval{0};
+  /// Publish a snapshot after every this many successful flips, or never
+  /// if 0; see Flip_engine::publish_snapshots()
+  std::size_t snapshot_interval{0};
+  /// How each flip is checked; Flip_validation::GEOMETRIC rejects flips
+  /// that would invert a cell, which LOCAL makes and the Delaunay repair
+  /// cannot undo
+  Flip_validation validation{Flip_validation::LOCAL};
+};
+
+/// @brief Throughput and rejection statistics for a batch of flips
+struct Flip_report
+{
+  std::size_t                                flips{};
+  std::size_t                                attempts{};
+  /// Rejected attempts, indexed by Flip_status
+  std::array<std::size_t, FLIP_STATUS_COUNT> rejections{};
+  std::size_t                                cells_before{};
+  std::size_t                                cells_after{};
+  /// Number of times storage was reordered
+  std::size_t                                relayouts{};
+  /// Number of snapshots published
+  std::size_t                                snapshots{};
+  std::chrono::duration<double>              elapsed{};
+
+  /// @return The number of attempts rejected for the given reason
+  [[nodiscard]] auto rejected(Flip_status status) const -> std::size_t
+  {
+    return rejections[static_cast<std::size_t>(status)];
+  }
+
+  /// @return Successful flips per second of wall-clock time
+  [[nodiscard]] auto flips_per_second() const -> double
+  {
+    if (elapsed.count() <= 0.0) { return 0.0; }
+    return static_cast<double>(flips) / elapsed.count();
+  }
+};
+
+/// @brief Print a flip report in human-readable form.
+/// @param report The report to print.
+inline void print_report(Flip_report const& report)
+{
+  fmt::print("Flips: {} of {} attempts in {:.3f} s ({:.0f} flips/s)\n",
+             report.flips, report.attempts, report.elapsed.count(),
+             report.flips_per_second());
+  for (std::size_t i = 1; i < FLIP_STATUS_COUNT; ++i)
+  {
+    if (report.rejections[i] == 0) { continue; }
+    fmt::print("  Rejected ({}): {}\n", to_string(static_cast<Flip_status>(i)),
+               report.rejections[i]);
+  }
+  fmt::print("Cells: {} -> {}\n", report.cells_before, report.cells_after);
+  if (report.relayouts > 0)
+  {
+    fmt::print("Storage reordered {} times\n", report.relayouts);
+  }
+  if (report.snapshots > 0)
+  {
+    fmt::print("Snapshots published: {}\n", report.snapshots);
+  }
+}  // print_report()
+
+/// @brief Choose top and bottom vertices for a flip of the given edge
+/// @details Top is one of the 4 vertices around the pivot edge, chosen at
+/// random, and bottom is the vertex opposite it, i.e. the one that shares
+/// no incident cell with top. Equivalently, one of the 2 ring diagonals
+/// from get_octahedron_diagonals() is chosen, in a random order.
+/// @param cells The 4 cells incident to the pivot edge
+/// @param edge The pivot edge
+/// @param generator A uniform random bit generator
+/// @return The top and bottom vertices, or std::nullopt
+template <typename Cell_handle_type, typename Generator>
+[[nodiscard]] auto choose_top_and_bottom(
+    Basic_octahedron_cells<Cell_handle_type> const& cells,
+    CGAL::Triple<Cell_handle_type, int, int> const& edge, Generator& generator)
+    -> std::optional<std::pair<Vertex_handle_of<Cell_handle_type>,
+                               Vertex_handle_of<Cell_handle_type>>>
+{
+  auto const diagonals =
+      get_octahedron_diagonals(cells, edge.first->vertex(edge.second),
+                               edge.first->vertex(edge.third));
+  if (!diagonals) { return std::nullopt; }
+
+  std::uniform_int_distribution<std::size_t> distribution(0, 3);
+  auto const  choice          = distribution(generator);
+  auto const& [first, second] = (*diagonals)[1 + choice / 2];
+  if (choice % 2 == 0) { return std::make_pair(first, second); }
+  return std::make_pair(second, first);
+}  // choose_top_and_bottom()
+
+/// @brief Accepts every flip that can be made
+struct Accept_all
+{
+  template <typename Triangulation>
+  auto operator()(Basic_flip_plan<Triangulation> const& /* plan */)
+      const noexcept -> bool
+  {
+    return true;
+  }
+};
+
+/// @brief Applies bistellar flips to a triangulation back to back
+template <typename Triangulation>
+class Basic_flip_engine
+{
+ public:
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Plan               = Basic_flip_plan<Triangulation>;
+  using Index              = Basic_pivot_edge_index<Triangulation>;
+  using Repair             = Basic_delaunay_repair<Triangulation>;
+  using Stars              = Star_cache<Triangulation>;
+
+  /// @brief Index the pivot edges of the triangulation
+  /// @param triangulation The triangulation to flip; must outlive the engine
+  /// @param seed Seed for choosing candidate edges and top vertices
+  explicit Basic_flip_engine(Triangulation& triangulation,
+                             std::uint64_t  seed = 0)
+      : m_triangulation{triangulation}
+      , m_index{triangulation}
+      , m_generator{seed}
+  {}
+
+  /// @return The index of pivot edges kept by the engine
+  [[nodiscard]] auto index() const -> Index const&
+  {
+    return m_index;
+  }
+
+  /// @brief Queue the new cells of every flip from now on
+  /// @details Call while the triangulation is Delaunay, or call
+  /// Delaunay_repair::mark_all() on the result once. The queue then tells
+  /// whether the triangulation is still Delaunay, and restore_delaunay()
+  /// restores it, checking only cells near the flips made since.
+  /// @return The queue of cells that may not be locally Delaunay
+  auto track_delaunay() -> Repair&
+  {
+    if (!m_repair) { m_repair.emplace(m_triangulation); }
+    return *m_repair;
+  }
+
+  /// @brief Keep vertex degrees and edge valences up to date across the
+  /// flips made from now on
+  /// @details The first call counts every star once; see Star_cache.
+  /// Vertex info is not touched. An acceptance test given to step() or
+  /// run() can read the change a planned flip would make from
+  /// Star_cache::delta().
+  /// @return The degrees and valences of the triangulation
+  auto track_stars() -> Stars&
+  {
+    if (!m_stars) { m_stars.emplace(m_triangulation); }
+    return *m_stars;
+  }
+
+  /// @return The degrees and valences, or nullptr if not tracking
+  [[nodiscard]] auto stars() const -> Stars const*
+  {
+    return m_stars ? &*m_stars : nullptr;
+  }
+
+  /// @brief Publish snapshots of the triangulation from run()
+  /// @details Every Flip_engine_options::snapshot_interval successful
+  /// flips, run() publishes a snapshot, and once at the end, so analysis
+  /// threads can measure it while flipping continues.
+  /// @param publisher Receives the snapshots; must outlive the engine
+  void publish_snapshots(Snapshot_publisher& publisher)
+  {
+    m_publisher = &publisher;
+  }
+
+  /// @brief Restore the Delaunay property around the flips made since
+  /// track_delaunay(), keeping the index of pivot edges up to date
+  /// @details Cells inverted by a flip cannot be repaired and are reported
+  /// as remaining; see Delaunay_repair::restore(). Star_cache follows only
+  /// 4-4 flips, so if any move was made, a tracked Star_cache is rebuilt.
+  /// @return What was done; nothing if the engine is not tracking
+  auto restore_delaunay() -> Delaunay_repair_report
+  {
+    if (!m_repair) { return Delaunay_repair_report{}; }
+    auto const report = m_repair->restore(
+        [this](Basic_move_result<Triangulation> const& result,
+               Vertex_handle_type const&               first,
+               Vertex_handle_type const&               second) {
+          if (result.type == Move_type::THREE_TWO)
+          {
+            m_index.erase(make_vertex_pair(first, second));
+          }
+          m_index.refresh(m_triangulation, result.cells);
+        });
+    if (m_stars && report.moves() > 0) { m_stars.emplace(m_triangulation); }
+    return report;
+  }
+
+  /// @brief Reorder the triangulation's storage along a Hilbert curve
+  /// @details Every handle into the triangulation is invalidated, so the
+  /// index of pivot edges and any Star_cache are rebuilt and the queue of
+  /// candidates is dropped. If the engine is tracking and some cells were
+  /// not yet known to be Delaunay, every cell is checked again by the next
+  /// restore_delaunay().
+  /// @return True if reordered, false if the dimension is not 3
+  auto relayout() -> bool
+  {
+    auto const dirty = m_repair && m_repair->size() > 0;
+    if (!::relayout(m_triangulation)) { return false; }
+    m_index = Index(m_triangulation);
+    m_queue.clear();
+    if (m_stars) { m_stars.emplace(m_triangulation); }
+    if (m_repair)
+    {
+      m_repair.emplace(m_triangulation);
+      if (dirty) { m_repair->mark_all(); }
+    }
+    return true;
+  }
+
+  /// @brief Attempt one flip on the next candidate edge in the queue
+  /// @tparam Accept Callable as bool(Plan const&)
+  /// @param accept Decides whether a flip that can be made is made, e.g. by
+  /// Metropolis; called before the triangulation is changed
+  /// @param validation How the flip is checked; see apply_flip()
+  /// @return Whether the flip succeeded, or why it was rejected
+  template <typename Accept = Accept_all>
+  auto step(Accept&&        accept     = Accept{},
+            Flip_validation validation = Flip_validation::LOCAL)
+      -> Flip_status
+  {
+    if (m_queue.empty()) { refill(1); }
+    if (m_queue.empty()) { return record_outcome(Flip_status::INVALID_EDGE); }
+    auto const candidate = m_queue.front();
+    m_queue.pop_front();
+
+    // Earlier flips may have changed the valence of a queued edge
+    auto const edge = m_index.find(candidate.first, candidate.second);
+    if (!edge) { return record_outcome(Flip_status::WRONG_VALENCE); }
+
+    auto const incident_cells = get_octahedron_cells(m_triangulation, *edge);
+    if (!incident_cells) { return record_outcome(Flip_status::WRONG_VALENCE); }
+    auto const top_and_bottom =
+        choose_top_and_bottom(*incident_cells, *edge, m_generator);
+    if (!top_and_bottom)
+    {
+      return record_outcome(Flip_status::WRONG_PIVOT_VERTEX_COUNT);
+    }
+
+    auto const plan = plan_flip(m_triangulation, *edge, top_and_bottom->first,
+                                top_and_bottom->second);
+    if (plan && !accept(plan))
+    {
+      return record_outcome(Flip_status::NOT_ACCEPTED);
+    }
+    auto const result = apply_flip(m_triangulation, plan, validation);
+    m_index.update(m_triangulation, candidate, result);
+    if (result && m_repair) { m_repair->mark(result.cells); }
+    if (result && m_stars) { m_stars->update(plan); }
+    return result.status;
+  }
+
+  /// @brief Flip until the target number of flips or the time budget is
+  /// reached
+  /// @tparam Accept Callable as bool(Plan const&)
+  /// @param options When to stop
+  /// @param accept Decides whether each flip that can be made is made; see
+  /// step()
+  /// @return Throughput and rejection statistics
+  template <typename Accept = Accept_all>
+  auto run(Flip_engine_options const& options, Accept&& accept = Accept{})
+      -> Flip_report
+  {
+    using Clock = std::chrono::steady_clock;
+    Flip_report report;
+    report.cells_before = m_triangulation.number_of_cells();
+    auto const  start   = Clock::now();
+    std::size_t consecutive_rejections = 0;
+
+    while (report.flips < options.target_flips &&
+           consecutive_rejections < options.max_consecutive_rejections &&
+           !m_index.empty())
+    {
+      // Reading the clock is not free, so only check it every so often
+      if (report.attempts % TIME_CHECK_INTERVAL == 0 &&
+          Clock::now() - start >= options.time_budget)
+      {
+        break;
+      }
+      if (m_queue.empty()) { refill(options.batch_size); }
+
+      auto const status = step(accept, options.validation);
+      ++report.attempts;
+      if (status == Flip_status::SUCCESS)
+      {
+        ++report.flips;
+        ++m_flips;
+        consecutive_rejections = 0;
+        if (options.relayout_interval > 0 &&
+            report.flips % options.relayout_interval == 0 && relayout())
+        {
+          ++report.relayouts;
+        }
+        if (m_publisher && options.snapshot_interval > 0 &&
+            report.flips % options.snapshot_interval == 0)
+        {
+          publish(report);
+        }
+      }
+      else
+      {
+        ++report.rejections[static_cast<std::size_t>(status)];
+        ++consecutive_rejections;
+      }
+    }
+
+    // The final state, unless it was just published
+    if (m_publisher && options.snapshot_interval > 0 &&
+        (report.flips == 0 || report.flips % options.snapshot_interval != 0))
+    {
+      publish(report);
+    }
+
+    report.elapsed     = Clock::now() - start;
+    report.cells_after = m_triangulation.number_of_cells();
+    return report;
+  }
+
+ private:
+  static constexpr std::size_t TIME_CHECK_INTERVAL = 256;
+
+  void refill(std::size_t count)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto const edge = m_index.sample(m_generator);
+      if (!edge) { return; }
+      m_queue.emplace_back(make_vertex_pair(*edge));
+    }
+  }
+
+  void publish(Flip_report& report)
+  {
+    m_publisher->publish(m_triangulation, m_flips);
+    ++report.snapshots;
+  }
+
+  Triangulation&                                    m_triangulation;
+  Index                                             m_index;
+  std::mt19937_64                                   m_generator;
+  std::deque<Basic_vertex_pair<Vertex_handle_type>> m_queue;
+  std::optional<Repair>                             m_repair;
+  std::optional<Stars>                              m_stars;
+  Snapshot_publisher*                               m_publisher{};
+  /// Successful flips over every run, for the snapshots
+  std::size_t                                       m_flips{};
+};
+
+using Flip_engine = Basic_flip_engine<Delaunay>;
+
+#endif  // BISTELLAR_FLIP_FLIP_ENGINE_HPP
@@ -0,0 +1,195 @@
+/// @file flip_journal.hpp
+/// @brief Undo bistellar flips from a compact journal
+/// @author Adam Getchell
+/// @details A flip rewrites 4 cells in place, so it can be undone from the
+/// plan that produced it: the 6 vertices, the 4 cells, the 8 exterior
+/// neighbors and their mirror indices. Each record also keeps the incident
+/// cells of the 6 vertices and the info of the 4 cells, so undoing restores
+/// the triangulation exactly, in O(1), without copying it. A triangulation
+/// whose cells store no info keeps only the handles.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_FLIP_JOURNAL_HPP
+#define BISTELLAR_FLIP_FLIP_JOURNAL_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+
+/// The information stored in each cell, or std::monostate if none
+template <typename Triangulation>
+using Cell_info_t = typename Info_of<typename Triangulation::Cell>::type;
+using Cell_info   = Cell_info_t<Delaunay>;
+
+/// @brief Everything needed to undo one bistellar flip
+template <typename Triangulation>
+struct Basic_flip_record
+{
+  /// The plan the flip was applied from
+  Basic_flip_plan<Triangulation>              plan;
+  /// The incident cell of each of the 6 vertices, in Flip_plan::vertices()
+  /// order, before the flip
+  std::array<Cell_handle_t<Triangulation>, 6> vertex_cells{};
+  /// The info of the 4 old cells before the flip
+  std::array<Cell_info_t<Triangulation>, 4>   infos{};
+};
+
+using Flip_record = Basic_flip_record<Delaunay>;
+
+/// @brief Record what a flip will overwrite, before applying it
+/// @param plan A successful plan from plan_flip()
+/// @return A record from which the flip can be undone
+template <typename Triangulation>
+[[nodiscard]] auto make_flip_record(Basic_flip_plan<Triangulation> const& plan)
+    -> Basic_flip_record<Triangulation>
+{
+  Basic_flip_record<Triangulation> record{plan, {}, {}};
+  auto const                       vertices = plan.vertices();
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    record.vertex_cells[i] = vertices[i]->cell();
+  }
+  if constexpr (Has_info<typename Triangulation::Cell>)
+  {
+    for (std::size_t i = 0; i < plan.cells.size(); ++i)
+    {
+      record.infos[i] = plan.cells[i]->info();
+    }
+  }
+  return record;
+}  // make_flip_record()
+
+/// @brief Restore the 4 cells of a flip as they were before it
+/// @details The cells are rewritten in place, so cell handles taken before
+/// the flip are valid again. Flips must be undone in the reverse order they
+/// were applied.
+/// @param triangulation The flipped triangulation
+/// @param record The record made before the flip
+/// @return The restored cells and the original pivot edge
+template <typename Triangulation>
+auto undo_flip([[maybe_unused]] Triangulation&         triangulation,
+               Basic_flip_record<Triangulation> const& record)
+    -> Basic_flip_result<Triangulation>
+{
+  auto const& before   = record.plan.cells;
+  auto const& before_1 = before[0];
+  restore_flip_cells(record.plan);
+
+  auto const vertices = record.plan.vertices();
+  for (std::size_t i = 0; i < vertices.size(); ++i)
+  {
+    vertices[i]->set_cell(record.vertex_cells[i]);
+  }
+  if constexpr (Has_info<typename Triangulation::Cell>)
+  {
+    for (std::size_t i = 0; i < before.size(); ++i)
+    {
+      before[i]->info() = record.infos[i];
+    }
+  }
+
+  assert(is_locally_valid(triangulation, before));
+  return Basic_flip_result<Triangulation>{
+      Flip_status::SUCCESS, before,
+      Edge_handle_t<Triangulation>{
+          before_1, before_1->index(record.plan.pivot_from_1),
+          before_1->index(record.plan.pivot_from_2)}
+  };
+}  // undo_flip()
+
+/// @brief A stack of flips that can be rolled back to a checkpoint
+/// @details For Metropolis updates: propose a flip, and undo it if the move
+/// is rejected, instead of copying the triangulation beforehand.
+template <typename Triangulation>
+class Basic_flip_journal
+{
+ public:
+  using Edge_handle_type   = Edge_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Record             = Basic_flip_record<Triangulation>;
+  using Result             = Basic_flip_result<Triangulation>;
+
+  /// @brief Apply a flip and record how to undo it
+  /// @details If the flip is rejected, apply_flip() has already left the
+  /// triangulation as it was, and nothing is recorded.
+  /// @param triangulation The triangulation to flip
+  /// @param edge The edge to pivot on
+  /// @param top Top vertex of the cells being flipped
+  /// @param bottom Bottom vertex of the cells being flipped
+  /// @return The new cells and pivot edge, or the reason the flip was rejected
+  auto flip(Triangulation& triangulation, Edge_handle_type const& edge,
+            Vertex_handle_type const& top, Vertex_handle_type const& bottom)
+      -> Result
+  {
+    auto const plan = plan_flip(triangulation, edge, top, bottom);
+    if (!plan) { return Result{plan.status}; }
+    auto record = make_flip_record(plan);
+    auto result = apply_flip(triangulation, plan);
+    if (!result) { return result; }
+    m_records.emplace_back(record);
+    return result;
+  }
+
+  /// @return A checkpoint to roll back to; the number of recorded flips
+  [[nodiscard]] auto checkpoint() const noexcept -> std::size_t
+  {
+    return m_records.size();
+  }
+
+  /// @return The number of recorded flips
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_records.size();
+  }
+
+  /// @return True if there are no flips to undo
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_records.empty();
+  }
+
+  /// @return The record of the most recent flip
+  [[nodiscard]] auto back() const -> Record const&
+  {
+    return m_records.back();
+  }
+
+  /// @brief Undo the most recent flip
+  /// @param triangulation The flipped triangulation
+  /// @return The restored cells and the original pivot edge
+  auto undo(Triangulation& triangulation) -> Result
+  {
+    auto result = undo_flip(triangulation, m_records.back());
+    m_records.pop_back();
+    return result;
+  }
+
+  /// @brief Undo flips, most recent first, back to a checkpoint
+  /// @param triangulation The flipped triangulation
+  /// @param checkpoint A value returned by checkpoint()
+  /// @return The number of flips undone
+  auto rollback(Triangulation& triangulation, std::size_t checkpoint)
+      -> std::size_t
+  {
+    std::size_t undone = 0;
+    while (m_records.size() > checkpoint)
+    {
+      (void)undo(triangulation);
+      ++undone;
+    }
+    return undone;
+  }
+
+  /// @brief Accept all recorded flips; they can no longer be undone
+  void commit() noexcept { m_records.clear(); }
+
+ private:
+  std::vector<Record> m_records;
+};
+
+using Flip_journal = Basic_flip_journal<Delaunay>;
+
+#endif  // BISTELLAR_FLIP_FLIP_JOURNAL_HPP
@@ -0,0 +1,53 @@
+/// @file flip_status.hpp
+/// @brief The outcomes of a bistellar flip
+/// @author Adam Getchell
+/// @details Kept apart from bistellar_flip.hpp so that instrumentation.hpp
+/// can count outcomes without depending on the flip itself.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_FLIP_STATUS_HPP
+#define BISTELLAR_FLIP_FLIP_STATUS_HPP
+
+#include <cstddef>
+#include <string>
+
+/// @brief The reasons a bistellar flip can be rejected
+enum class Flip_status
+{
+  SUCCESS,
+  INVALID_EDGE,
+  WRONG_VALENCE,
+  INVALID_CELL,
+  WRONG_PIVOT_VERTEX_COUNT,
+  PIVOT_EDGE_EXISTS,
+  FACET_EXISTS,
+  /// A new cell would be flat or negatively oriented
+  INVERTED_CELL,
+  /// The flip could be made, but an acceptance test such as Metropolis
+  /// declined it
+  NOT_ACCEPTED
+};
+
+/// The number of values of Flip_status, for tables indexed by status
+inline constexpr std::size_t FLIP_STATUS_COUNT = 9;
+
+/// @return A human-readable name for a flip status
+[[nodiscard]] inline auto to_string(Flip_status status) -> std::string
+{
+  switch (status)
+  {
+    case Flip_status::SUCCESS: return "success";
+    case Flip_status::INVALID_EDGE: return "invalid edge";
+    case Flip_status::WRONG_VALENCE: return "wrong valence";
+    case Flip_status::INVALID_CELL: return "invalid cell";
+    case Flip_status::WRONG_PIVOT_VERTEX_COUNT:
+      return "wrong pivot vertex count";
+    case Flip_status::PIVOT_EDGE_EXISTS: return "pivot edge exists";
+    case Flip_status::FACET_EXISTS: return "facet exists";
+    case Flip_status::INVERTED_CELL: return "inverted cell";
+    case Flip_status::NOT_ACCEPTED: return "not accepted";
+  }
+  return "unknown";
+}  // to_string()
+
+#endif  // BISTELLAR_FLIP_FLIP_STATUS_HPP
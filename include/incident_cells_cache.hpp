@@ -0,0 +1,105 @@
+/// @file incident_cells_cache.hpp
+/// @brief Cache the cells incident to each vertex across flips
+/// @author Adam Getchell
+/// @details CGAL's flip_n_to_m takes a map from each vertex to its incident
+/// cells. Gathering them walks the star of the vertex, so rather than
+/// rebuilding the map for every vertex before every flip, this cache fills
+/// an entry the first time it is asked for and forgets only the entries of
+/// vertices whose stars a flip changed.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_INCIDENT_CELLS_CACHE_HPP
+#define BISTELLAR_FLIP_INCIDENT_CELLS_CACHE_HPP
+
+#include <boost/container/small_vector.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include <unordered_map>
+#include <utility>
+
+/// @brief The cells incident to each vertex, filled on demand
+/// @tparam Triangulation A CGAL 3D triangulation
+template <typename Triangulation>
+class Incident_cells_cache
+{
+ public:
+  using Vertex_handle = typename Triangulation::Vertex_handle;
+  using Cell_handle   = typename Triangulation::Cell_handle;
+  using Cells         = boost::container::small_vector<Cell_handle, 64>;
+  /// The map type taken by CGAL::Tetrahedral_remeshing::internal::flip_n_to_m
+  using Map = std::unordered_map<Vertex_handle, boost::optional<Cells>>;
+
+  /// @param triangulation The triangulation; must outlive the cache
+  explicit Incident_cells_cache(Triangulation const& triangulation)
+      : m_triangulation{&triangulation}
+  {}
+
+  /// @brief The cells incident to a vertex, gathered on the first request
+  /// @param vertex A vertex of the triangulation
+  /// @return The incident cells, including infinite ones
+  auto operator[](Vertex_handle const& vertex) -> Cells const&
+  {
+    auto& entry = m_cells[vertex];
+    if (!entry)
+    {
+      Cells cells;
+      m_triangulation->tds().incident_cells(vertex,
+                                            std::back_inserter(cells));
+      entry = std::move(cells);
+      ++m_misses;
+    }
+    return *entry;
+  }
+
+  /// @brief Forget the entries of every vertex of the given cells
+  /// @details Call with the new cells of a move. A move only changes the
+  /// stars of the vertices of its new cells, and cells it deletes have no
+  /// other vertices, except a vertex removed by a 4-1 move, which must be
+  /// erased separately.
+  /// @param cells The cells created or rewritten by a move
+  template <std::ranges::input_range Range>
+  void invalidate(Range const& cells)
+  {
+    for (auto const& cell : cells)
+    {
+      for (int i = 0; i < 4; ++i)
+      {
+        if (auto entry = m_cells.find(cell->vertex(i)); entry != m_cells.end())
+        {
+          entry->second = boost::none;
+        }
+      }
+    }
+  }
+
+  /// @brief Forget a vertex, e.g. one removed from the triangulation
+  void erase(Vertex_handle const& vertex) { m_cells.erase(vertex); }
+
+  /// @brief Forget every entry
+  void clear() noexcept { m_cells.clear(); }
+
+  /// @return The number of vertices with an entry, valid or not
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_cells.size();
+  }
+
+  /// @return How many entries were gathered from the triangulation
+  [[nodiscard]] auto misses() const noexcept -> std::size_t
+  {
+    return m_misses;
+  }
+
+  /// @return The underlying map, for functions that update it themselves,
+  /// such as flip_n_to_m
+  [[nodiscard]] auto map() noexcept -> Map& { return m_cells; }
+
+ private:
+  Triangulation const* m_triangulation;
+  Map                  m_cells;
+  std::size_t          m_misses{};
+};
+
+#endif  // BISTELLAR_FLIP_INCIDENT_CELLS_CACHE_HPP
@@ -0,0 +1,305 @@
+/// @file instrumentation.hpp
+/// @brief Stage timers and outcome counters for the flip pipeline
+/// @author Adam Getchell
+/// @details Configure with -DENABLE_INSTRUMENTATION=ON, which defines
+/// BISTELLAR_FLIP_INSTRUMENTATION, to time each stage of every bistellar
+/// flip and count every outcome in any build type. Otherwise the timers are
+/// empty and the counting functions do nothing, so instrumentation compiles
+/// out completely; the snapshot and report functions still compile and
+/// report zeros. Counters are relaxed atomics on separate cache lines, so
+/// flips on several threads may record concurrently.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_INSTRUMENTATION_HPP
+#define BISTELLAR_FLIP_INSTRUMENTATION_HPP
+
+#include <fmt/core.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "flip_status.hpp"
+
+/// True if instrumentation was enabled at configure time
+#ifdef BISTELLAR_FLIP_INSTRUMENTATION
+inline constexpr bool INSTRUMENTATION_ENABLED = true;
+#else
+inline constexpr bool INSTRUMENTATION_ENABLED = false;
+#endif
+
+/// @brief The stages of a bistellar flip
+enum class Flip_stage
+{
+  /// Finding the 4 cells incident to the pivot edge
+  INCIDENT_CELLS,
+  /// Finding the new pivot vertices and labelling the old cells
+  CLASSIFICATION,
+  /// Rewriting the vertices of the old cells as the new cells
+  CELL_CREATION,
+  /// Setting the neighbors of the new cells and their exterior neighbors
+  NEIGHBOR_WIRING,
+  /// Reorienting and checking the new cells
+  VALIDATION
+};
+
+/// The number of values of Flip_stage, for tables indexed by stage
+inline constexpr std::size_t FLIP_STAGE_COUNT = 5;
+
+/// @return A human-readable name for a flip stage
+[[nodiscard]] inline auto to_string(Flip_stage stage) -> std::string
+{
+  switch (stage)
+  {
+    case Flip_stage::INCIDENT_CELLS: return "incident cells";
+    case Flip_stage::CLASSIFICATION: return "classification";
+    case Flip_stage::CELL_CREATION: return "cell creation";
+    case Flip_stage::NEIGHBOR_WIRING: return "neighbor wiring";
+    case Flip_stage::VALIDATION: return "validation";
+  }
+  return "unknown";
+}  // to_string()
+
+/// @brief The instrumentation counters at one moment
+/// @details Subtract an earlier snapshot from a later one for the counts of
+/// the flips in between, e.g. one sweep.
+struct Instrumentation_snapshot
+{
+  /// Total time spent in each stage, indexed by Flip_stage
+  std::array<std::uint64_t, FLIP_STAGE_COUNT>  stage_nanoseconds{};
+  /// Number of times each stage was entered
+  std::array<std::uint64_t, FLIP_STAGE_COUNT>  stage_calls{};
+  /// Number of flips with each outcome, indexed by Flip_status
+  std::array<std::uint64_t, FLIP_STATUS_COUNT> outcomes{};
+
+  /// @return The time spent in a stage
+  [[nodiscard]] auto time(Flip_stage stage) const -> std::chrono::nanoseconds
+  {
+    return std::chrono::nanoseconds{
+        stage_nanoseconds[static_cast<std::size_t>(stage)]};
+  }
+
+  /// @return The number of flips with the given outcome
+  [[nodiscard]] auto count(Flip_status status) const -> std::uint64_t
+  {
+    return outcomes[static_cast<std::size_t>(status)];
+  }
+
+  /// @return The number of flips attempted, whatever their outcome
+  [[nodiscard]] auto attempts() const -> std::uint64_t
+  {
+    std::uint64_t total = 0;
+    for (auto const outcome : outcomes) { total += outcome; }
+    return total;
+  }
+
+  /// @return The counts since an earlier snapshot
+  [[nodiscard]] auto operator-(Instrumentation_snapshot const& earlier) const
+      -> Instrumentation_snapshot
+  {
+    Instrumentation_snapshot difference;
+    for (std::size_t i = 0; i < FLIP_STAGE_COUNT; ++i)
+    {
+      difference.stage_nanoseconds[i] =
+          stage_nanoseconds[i] - earlier.stage_nanoseconds[i];
+      difference.stage_calls[i] = stage_calls[i] - earlier.stage_calls[i];
+    }
+    for (std::size_t i = 0; i < FLIP_STATUS_COUNT; ++i)
+    {
+      difference.outcomes[i] = outcomes[i] - earlier.outcomes[i];
+    }
+    return difference;
+  }
+};
+
+/// @brief The process-wide instrumentation counters
+class Flip_instrumentation
+{
+ public:
+  /// @return The counters shared by all flips in the process
+  [[nodiscard]] static auto instance() -> Flip_instrumentation&
+  {
+    static Flip_instrumentation counters;
+    return counters;
+  }
+
+  /// @brief Add the time spent in one pass through a stage
+  void record(Flip_stage stage, std::chrono::nanoseconds time) noexcept
+  {
+    auto& counter = m_stages[static_cast<std::size_t>(stage)];
+    counter.nanoseconds.fetch_add(static_cast<std::uint64_t>(time.count()),
+                                  std::memory_order_relaxed);
+    counter.calls.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /// @brief Count the outcome of a flip
+  void record(Flip_status status) noexcept
+  {
+    m_outcomes[static_cast<std::size_t>(status)].value.fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  /// @return The current counts; not atomic as a whole while flips run
+  [[nodiscard]] auto snapshot() const -> Instrumentation_snapshot
+  {
+    Instrumentation_snapshot result;
+    for (std::size_t i = 0; i < FLIP_STAGE_COUNT; ++i)
+    {
+      result.stage_nanoseconds[i] =
+          m_stages[i].nanoseconds.load(std::memory_order_relaxed);
+      result.stage_calls[i] = m_stages[i].calls.load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < FLIP_STATUS_COUNT; ++i)
+    {
+      result.outcomes[i] = m_outcomes[i].value.load(std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /// @brief Set every count to zero
+  void reset() noexcept
+  {
+    for (auto& stage : m_stages)
+    {
+      stage.nanoseconds.store(0, std::memory_order_relaxed);
+      stage.calls.store(0, std::memory_order_relaxed);
+    }
+    for (auto& outcome : m_outcomes)
+    {
+      outcome.value.store(0, std::memory_order_relaxed);
+    }
+  }
+
+ private:
+  Flip_instrumentation() = default;
+
+  /// Cache line size, so threads counting different things do not contend
+  static constexpr std::size_t CACHE_LINE = 64;
+
+  struct alignas(CACHE_LINE) Stage_counter
+  {
+    std::atomic<std::uint64_t> nanoseconds{};
+    std::atomic<std::uint64_t> calls{};
+  };
+
+  struct alignas(CACHE_LINE) Outcome_counter
+  {
+    std::atomic<std::uint64_t> value{};
+  };
+
+  std::array<Stage_counter, FLIP_STAGE_COUNT>    m_stages{};
+  std::array<Outcome_counter, FLIP_STATUS_COUNT> m_outcomes{};
+};
+
+/// @brief Time consecutive stages of a flip
+/// @details Construct at the start of the first stage and call next() at
+/// the start of each later one. The current stage ends at the next call to
+/// next(), or when the timer is destroyed, e.g. by an early return.
+template <bool Enabled = INSTRUMENTATION_ENABLED>
+class Basic_stage_timer
+{
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  explicit Basic_stage_timer(Flip_stage stage) noexcept
+      : m_stage{stage}, m_start{Clock::now()}
+  {}
+
+  Basic_stage_timer(Basic_stage_timer const&)                    = delete;
+  auto operator=(Basic_stage_timer const&) -> Basic_stage_timer& = delete;
+
+  ~Basic_stage_timer() { stop(); }
+
+  /// @brief End the current stage and start another
+  void next(Flip_stage stage) noexcept
+  {
+    auto const now = Clock::now();
+    Flip_instrumentation::instance().record(m_stage, now - m_start);
+    m_stage = stage;
+    m_start = now;
+  }
+
+ private:
+  void stop() noexcept
+  {
+    Flip_instrumentation::instance().record(m_stage, Clock::now() - m_start);
+  }
+
+  Flip_stage        m_stage;
+  Clock::time_point m_start;
+};
+
+/// @brief A timer that does nothing, when instrumentation is disabled
+template <>
+class Basic_stage_timer<false>
+{
+ public:
+  explicit Basic_stage_timer(Flip_stage /* stage */) noexcept {}
+
+  void next(Flip_stage /* stage */) noexcept {}
+};
+
+using Stage_timer = Basic_stage_timer<>;
+
+/// @brief Count the outcome of a flip, if instrumentation is enabled
+/// @param status The outcome
+/// @return The outcome, so a return statement can be wrapped
+inline auto record_outcome(Flip_status status) noexcept -> Flip_status
+{
+  if constexpr (INSTRUMENTATION_ENABLED)
+  {
+    Flip_instrumentation::instance().record(status);
+  }
+  return status;
+}  // record_outcome()
+
+/// @return The current instrumentation counters, all zero if disabled
+[[nodiscard]] inline auto instrumentation_snapshot()
+    -> Instrumentation_snapshot
+{
+  return Flip_instrumentation::instance().snapshot();
+}  // instrumentation_snapshot()
+
+/// @brief Print instrumentation counters in human-readable form
+/// @param snapshot The counters, e.g. the difference of two snapshots
+inline void print_instrumentation(Instrumentation_snapshot const& snapshot)
+{
+  if constexpr (!INSTRUMENTATION_ENABLED)
+  {
+    fmt::print("Instrumentation disabled; configure with "
+               "-DENABLE_INSTRUMENTATION=ON\n");
+    return;
+  }
+  std::uint64_t total = 0;
+  for (auto const nanoseconds : snapshot.stage_nanoseconds)
+  {
+    total += nanoseconds;
+  }
+  fmt::print("Time per stage:\n");
+  for (std::size_t i = 0; i < FLIP_STAGE_COUNT; ++i)
+  {
+    auto const nanoseconds = snapshot.stage_nanoseconds[i];
+    auto const calls       = snapshot.stage_calls[i];
+    fmt::print("  {:<16} {:>12.3f} ms {:>6.1f}% {:>10.1f} ns/call\n",
+               to_string(static_cast<Flip_stage>(i)),
+               static_cast<double>(nanoseconds) / 1e6,
+               total == 0 ? 0.0
+                          : 100.0 * static_cast<double>(nanoseconds) /
+                                static_cast<double>(total),
+               calls == 0 ? 0.0
+                          : static_cast<double>(nanoseconds) /
+                                static_cast<double>(calls));
+  }
+  fmt::print("Outcomes of {} flips:\n", snapshot.attempts());
+  for (std::size_t i = 0; i < FLIP_STATUS_COUNT; ++i)
+  {
+    if (snapshot.outcomes[i] == 0) { continue; }
+    fmt::print("  {:<26} {:>12}\n", to_string(static_cast<Flip_status>(i)),
+               snapshot.outcomes[i]);
+  }
+}  // print_instrumentation()
+
+#endif  // BISTELLAR_FLIP_INSTRUMENTATION_HPP
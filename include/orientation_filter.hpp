@@ -0,0 +1,118 @@
+/// @file orientation_filter.hpp
+/// @brief Orientation of several tetrahedra at once with a static filter
+/// @author Adam Getchell
+/// @details The determinants of a batch of tetrahedra are evaluated in
+/// double precision over structure-of-arrays lanes, which the compiler
+/// can vectorize, each with the error bound of CGAL's static filter for
+/// Orientation_3. Only lanes whose determinant is within the bound, or
+/// whose coordinates could underflow or overflow, fall back to the exact
+/// predicate CGAL::orientation().
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_ORIENTATION_FILTER_HPP
+#define BISTELLAR_FLIP_ORIENTATION_FILTER_HPP
+
+#include <CGAL/Kernel/global_functions_3.h>
+#include <CGAL/enum.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+/// The error bound of the static filter, relative to the product of the
+/// largest coordinate differences along each axis; from CGAL's
+/// Static_filters/Orientation_3.h
+inline constexpr double ORIENTATION_FILTER_EPSILON = 5.1107127829973299e-15;
+
+/// Coordinate differences below this may underflow in the error bound
+inline constexpr double ORIENTATION_FILTER_MIN = 1e-97;
+
+/// Coordinate differences above this may overflow in the determinant
+inline constexpr double ORIENTATION_FILTER_MAX = 1e102;
+
+/// @brief The orientations of a batch of tetrahedra
+/// @details Equivalent to calling CGAL::orientation(p, q, r, s) on each.
+/// @tparam N The number of tetrahedra
+/// @param tetrahedra The 4 points p, q, r, s of each tetrahedron
+/// @return POSITIVE, NEGATIVE, or ZERO if flat, for each tetrahedron
+template <typename Triangulation_point, std::size_t N>
+[[nodiscard]] auto batch_orientation(
+    std::array<std::array<Triangulation_point, 4>, N> const& tetrahedra)
+    -> std::array<CGAL::Orientation, N>
+{
+  // Gather the edges from p into lanes, so the arithmetic below vectorizes
+  std::array<double, N> pqx{};
+  std::array<double, N> pqy{};
+  std::array<double, N> pqz{};
+  std::array<double, N> prx{};
+  std::array<double, N> pry{};
+  std::array<double, N> prz{};
+  std::array<double, N> psx{};
+  std::array<double, N> psy{};
+  std::array<double, N> psz{};
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    auto const& [p, q, r, s] = tetrahedra[i];
+    pqx[i]                   = q.x() - p.x();
+    pqy[i]                   = q.y() - p.y();
+    pqz[i]                   = q.z() - p.z();
+    prx[i]                   = r.x() - p.x();
+    pry[i]                   = r.y() - p.y();
+    prz[i]                   = r.z() - p.z();
+    psx[i]                   = s.x() - p.x();
+    psy[i]                   = s.y() - p.y();
+    psz[i]                   = s.z() - p.z();
+  }
+
+  // Same evaluation order as CGAL::determinant(), which the bound assumes
+  std::array<double, N> determinant{};
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    auto const m01 = pqx[i] * pry[i] - prx[i] * pqy[i];
+    auto const m02 = pqx[i] * psy[i] - psx[i] * pqy[i];
+    auto const m12 = prx[i] * psy[i] - psx[i] * pry[i];
+    determinant[i] = m01 * psz[i] - m02 * prz[i] + m12 * pqz[i];
+  }
+
+  // Out of range, the bound is infinite, so the exact predicate decides
+  auto const larger  = [](double a, double b) { return a < b ? b : a; };
+  auto const smaller = [](double a, double b) { return a < b ? a : b; };
+  std::array<double, N> bound{};
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    auto const maxx =
+        larger(std::abs(pqx[i]), larger(std::abs(prx[i]), std::abs(psx[i])));
+    auto const maxy =
+        larger(std::abs(pqy[i]), larger(std::abs(pry[i]), std::abs(psy[i])));
+    auto const maxz =
+        larger(std::abs(pqz[i]), larger(std::abs(prz[i]), std::abs(psz[i])));
+    auto const smallest = smaller(maxx, smaller(maxy, maxz));
+    auto const largest  = larger(maxx, larger(maxy, maxz));
+    auto const in_range = smallest >= ORIENTATION_FILTER_MIN &&
+                          largest <= ORIENTATION_FILTER_MAX;
+    bound[i] = in_range ? ORIENTATION_FILTER_EPSILON * maxx * maxy * maxz
+                        : std::numeric_limits<double>::infinity();
+  }
+
+  std::array<CGAL::Orientation, N> orientations{};
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    if (determinant[i] > bound[i])
+    {
+      orientations[i] = CGAL::POSITIVE;
+    }
+    else if (determinant[i] < -bound[i])
+    {
+      orientations[i] = CGAL::NEGATIVE;
+    }
+    else
+    {
+      auto const& [p, q, r, s] = tetrahedra[i];
+      orientations[i]          = CGAL::orientation(p, q, r, s);
+    }
+  }
+  return orientations;
+}  // batch_orientation()
+
+#endif  // BISTELLAR_FLIP_ORIENTATION_FILTER_HPP
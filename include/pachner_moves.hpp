@@ -0,0 +1,705 @@
+/// @file pachner_moves.hpp
+/// @brief In-place 1-4, 4-1, 2-3 and 3-2 moves, and a journal to undo them
+/// @author Adam Getchell
+/// @details Together with the 4-4 bistellar flip, these moves connect all
+/// triangulations of a point set (1-4 and 4-1 also change the point set).
+/// Like the 4-4 flip, each move rewrites the cells it touches in place,
+/// creating or deleting only the cells and vertices that differ in number,
+/// and only checks the combinatorics of the new cells, not their geometry.
+/// The 2-3 move replaces the facet shared by two cells with an edge joining
+/// their opposite vertices; the 3-2 move is its inverse. The 1-4 move
+/// inserts a vertex inside a cell; the 4-1 move removes a vertex of degree 4.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_PACHNER_MOVES_HPP
+#define BISTELLAR_FLIP_PACHNER_MOVES_HPP
+
+#include <CGAL/centroid.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/container/static_vector.hpp>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+
+/// @brief Give a reused or created cell the info of a new cell, if any
+template <typename Cell_handle_type>
+void reset_info(Cell_handle_type const& cell)
+{
+  if constexpr (Has_info<std::remove_cvref_t<decltype(*cell)>>)
+  {
+    cell->info() = {};
+  }
+}  // reset_info()
+
+/// @brief The bistellar moves in 3 dimensions, named by cells before and
+/// after
+enum class Move_type
+{
+  ONE_FOUR,
+  FOUR_ONE,
+  TWO_THREE,
+  THREE_TWO,
+  FOUR_FOUR
+};
+
+/// @return A human-readable name for a move
+[[nodiscard]] inline auto to_string(Move_type type) -> std::string
+{
+  switch (type)
+  {
+    case Move_type::ONE_FOUR: return "1-4";
+    case Move_type::FOUR_ONE: return "4-1";
+    case Move_type::TWO_THREE: return "2-3";
+    case Move_type::THREE_TWO: return "3-2";
+    case Move_type::FOUR_FOUR: return "4-4";
+  }
+  return "unknown";
+}  // to_string()
+
+/// @brief The result of an in-place move
+/// @details Only the handles of the new cells are returned; the
+/// triangulation itself is modified in place.
+template <typename Triangulation>
+struct Basic_move_result
+{
+  Move_type   type{Move_type::FOUR_FOUR};
+  Flip_status status{Flip_status::INVALID_EDGE};
+  /// The new cells: 4 after a 1-4 move, 1 after 4-1, 3 after 2-3, 2 after
+  /// 3-2 and 4 after 4-4
+  boost::container::static_vector<Cell_handle_t<Triangulation>, 4> cells{};
+  /// The vertex inserted by a 1-4 move
+  Vertex_handle_t<Triangulation> vertex{};
+
+  explicit operator bool() const { return status == Flip_status::SUCCESS; }
+};
+
+using Move_result = Basic_move_result<Delaunay>;
+
+/// @brief Insert a vertex inside a cell, splitting it into 4
+/// @details The old cell is reused as the first new cell. Each new cell
+/// keeps the vertex order of the old one, with the new vertex in place of
+/// one old vertex, so orientation is preserved when the point is inside.
+/// @param triangulation The triangulation to modify
+/// @param cell The finite cell to split
+/// @param point The point of the new vertex
+/// @return The 4 new cells and the new vertex, or why the move was rejected
+template <typename Triangulation>
+auto one_four_move(Triangulation&                      triangulation,
+                   Cell_handle_t<Triangulation> const& cell,
+                   typename Triangulation::Point const& point)
+    -> Basic_move_result<Triangulation>
+{
+  using Cell_handle_type   = Cell_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Result             = Basic_move_result<Triangulation>;
+
+  if (triangulation.dimension() != 3 || triangulation.is_infinite(cell))
+  {
+    return Result{Move_type::ONE_FOUR, Flip_status::INVALID_CELL};
+  }
+
+  auto&                             tds = triangulation.tds();
+  std::array<Vertex_handle_type, 4> old_vertices;
+  std::array<Cell_handle_type, 4>   neighbors;
+  std::array<int, 4>                mirrors{};
+  for (int i = 0; i < 4; ++i)
+  {
+    auto const slot    = static_cast<std::size_t>(i);
+    old_vertices[slot] = cell->vertex(i);
+    neighbors[slot]    = cell->neighbor(i);
+    mirrors[slot]      = triangulation.mirror_index(cell, i);
+  }
+
+  auto const vertex = tds.create_vertex();
+  vertex->set_point(point);
+  // new_i is the old cell with vertex i replaced by the new vertex
+  std::array<Cell_handle_type, 4> const cells{
+      cell, tds.create_cell(), tds.create_cell(), tds.create_cell()};
+  for (int i = 0; i < 4; ++i)
+  {
+    auto const& new_cell = cells[static_cast<std::size_t>(i)];
+    for (int j = 0; j < 4; ++j)
+    {
+      auto const slot = static_cast<std::size_t>(j);
+      new_cell->set_vertex(j, i == j ? vertex : old_vertices[slot]);
+      // Facets containing the new vertex are shared with the other new cells
+      new_cell->set_neighbor(j, i == j ? neighbors[slot] : cells[slot]);
+    }
+    reset_info(new_cell);
+  }
+  for (std::size_t i = 1; i < cells.size(); ++i)
+  {
+    neighbors[i]->set_neighbor(mirrors[i], cells[i]);
+  }
+
+  vertex->set_cell(cells[0]);
+  // Cell i does not contain old vertex i
+  old_vertices[0]->set_cell(cells[1]);
+  for (std::size_t i = 1; i < old_vertices.size(); ++i)
+  {
+    old_vertices[i]->set_cell(cells[0]);
+  }
+
+  return Result{
+      Move_type::ONE_FOUR, Flip_status::SUCCESS, {cells.begin(), cells.end()},
+      vertex
+  };
+}  // one_four_move()
+
+/// @brief Insert a vertex at the centroid of a cell, splitting it into 4
+/// @param triangulation The triangulation to modify
+/// @param cell The finite cell to split
+/// @return The 4 new cells and the new vertex, or why the move was rejected
+template <typename Triangulation>
+auto one_four_move(Triangulation&                      triangulation,
+                   Cell_handle_t<Triangulation> const& cell)
+    -> Basic_move_result<Triangulation>
+{
+  using Result = Basic_move_result<Triangulation>;
+  if (triangulation.dimension() != 3 || triangulation.is_infinite(cell))
+  {
+    return Result{Move_type::ONE_FOUR, Flip_status::INVALID_CELL};
+  }
+  return one_four_move(
+      triangulation, cell,
+      CGAL::centroid(cell->vertex(0)->point(), cell->vertex(1)->point(),
+                     cell->vertex(2)->point(), cell->vertex(3)->point()));
+}  // one_four_move()
+
+/// @brief Remove a vertex of degree 4, merging its 4 cells into 1
+/// @details The incident cell of the vertex is reused, with the vertex
+/// replaced by the one vertex of the star it does not contain.
+/// @param triangulation The triangulation to modify
+/// @param vertex The finite vertex to remove
+/// @return The new cell, or why the move was rejected
+template <typename Triangulation>
+auto four_one_move(Triangulation&                        triangulation,
+                   Vertex_handle_t<Triangulation> const& vertex)
+    -> Basic_move_result<Triangulation>
+{
+  using Result = Basic_move_result<Triangulation>;
+  if (triangulation.dimension() != 3 || triangulation.is_infinite(vertex))
+  {
+    return Result{Move_type::FOUR_ONE, Flip_status::WRONG_VALENCE};
+  }
+
+  auto const first  = vertex->cell();
+  auto const center = first->index(vertex);
+  // star[i] is the cell of the star without vertex i of first
+  std::array<Cell_handle_t<Triangulation>, 4> star;
+  for (int i = 0; i < 4; ++i)
+  {
+    star[static_cast<std::size_t>(i)] =
+        i == center ? first : first->neighbor(i);
+  }
+  for (auto const& cell : star)
+  {
+    if (triangulation.is_infinite(cell) || !cell->has_vertex(vertex))
+    {
+      return Result{Move_type::FOUR_ONE, Flip_status::WRONG_VALENCE};
+    }
+    // The star is closed if the facets around the vertex are all shared
+    // within it
+    auto const opposite = cell->index(vertex);
+    for (int i = 0; i < 4; ++i)
+    {
+      if (i == opposite) { continue; }
+      if (std::find(star.begin(), star.end(), cell->neighbor(i)) == star.end())
+      {
+        return Result{Move_type::FOUR_ONE, Flip_status::WRONG_VALENCE};
+      }
+    }
+  }
+
+  // The vertex of the link not in first, seen across any other facet
+  auto const missing =
+      triangulation.mirror_vertex(first, center == 0 ? 1 : 0);
+  auto& tds = triangulation.tds();
+  for (int i = 0; i < 4; ++i)
+  {
+    if (i == center) { continue; }
+    // The facet opposite vertex i of the merged cell is the exterior facet
+    // of star[i]
+    auto const& cell     = star[static_cast<std::size_t>(i)];
+    auto const  opposite = cell->index(vertex);
+    auto const  neighbor = cell->neighbor(opposite);
+    auto const  mirror   = triangulation.mirror_index(cell, opposite);
+    first->set_neighbor(i, neighbor);
+    neighbor->set_neighbor(mirror, first);
+  }
+  first->set_vertex(center, missing);
+  reset_info(first);
+  for (int i = 0; i < 4; ++i) { first->vertex(i)->set_cell(first); }
+
+  for (int i = 0; i < 4; ++i)
+  {
+    if (i != center) { tds.delete_cell(star[static_cast<std::size_t>(i)]); }
+  }
+  tds.delete_vertex(vertex);
+
+  return Result{Move_type::FOUR_ONE, Flip_status::SUCCESS, {first}};
+}  // four_one_move()
+
+/// @brief Replace the facet shared by two cells with an edge joining their
+/// opposite vertices, turning 2 cells into 3
+/// @details With facet vertices a, b, c, top opposite the facet in the
+/// cell and bottom opposite it in the neighbor, the new cells are:
+/// - new_c: the cell with c replaced by bottom (reused)
+/// - new_a: the neighbor with a replaced by top (reused)
+/// - new_b: the cell with b replaced by bottom (created)
+/// @param triangulation The triangulation to modify
+/// @param cell A finite cell
+/// @param facet The index in cell of the vertex opposite the facet
+/// @return The 3 new cells, or why the move was rejected
+template <typename Triangulation>
+auto two_three_move(Triangulation&                      triangulation,
+                    Cell_handle_t<Triangulation> const& cell, int facet)
+    -> Basic_move_result<Triangulation>
+{
+  using Result = Basic_move_result<Triangulation>;
+  if (triangulation.dimension() != 3 || facet < 0 || facet > 3)
+  {
+    return Result{Move_type::TWO_THREE, Flip_status::INVALID_CELL};
+  }
+  auto const neighbor = cell->neighbor(facet);
+  if (triangulation.is_infinite(cell) || triangulation.is_infinite(neighbor))
+  {
+    return Result{Move_type::TWO_THREE, Flip_status::INVALID_CELL};
+  }
+  auto const mirror = triangulation.mirror_index(cell, facet);
+  auto const top    = cell->vertex(facet);
+  auto const bottom = neighbor->vertex(mirror);
+  if (has_edge(top, bottom))
+  {
+    return Result{Move_type::TWO_THREE, Flip_status::PIVOT_EDGE_EXISTS};
+  }
+
+  auto const a = cell->vertex((facet + 1) & 3);
+  auto const b = cell->vertex((facet + 2) & 3);
+  auto const c = cell->vertex((facet + 3) & 3);
+  // Slots in cell (i_) and neighbor (j_)
+  auto const i_a = cell->index(a);
+  auto const i_b = cell->index(b);
+  auto const i_c = cell->index(c);
+  auto const j_a = neighbor->index(a);
+  auto const j_b = neighbor->index(b);
+  auto const j_c = neighbor->index(c);
+
+  // Exterior neighbors across the facets containing top (1) or bottom (2)
+  auto const n_1_a = cell->neighbor(i_a);
+  auto const m_1_a = triangulation.mirror_index(cell, i_a);
+  auto const n_1_b = cell->neighbor(i_b);
+  auto const m_1_b = triangulation.mirror_index(cell, i_b);
+  auto const n_2_b = neighbor->neighbor(j_b);
+  auto const m_2_b = triangulation.mirror_index(neighbor, j_b);
+  auto const n_2_c = neighbor->neighbor(j_c);
+  auto const m_2_c = triangulation.mirror_index(neighbor, j_c);
+
+  auto&      tds   = triangulation.tds();
+  auto const new_c = cell;
+  auto const new_a = neighbor;
+  auto const new_b = tds.create_cell();
+  for (int i = 0; i < 4; ++i) { new_b->set_vertex(i, cell->vertex(i)); }
+  new_b->set_vertex(i_b, bottom);
+  new_c->set_vertex(i_c, bottom);
+  new_a->set_vertex(j_a, top);
+
+  // new_c: a, b, bottom, top; keeps the facet a, b, top
+  new_c->set_neighbor(i_a, new_a);
+  new_c->set_neighbor(i_b, new_b);
+  new_c->set_neighbor(facet, n_2_c);
+
+  // new_a: top, b, c, bottom; keeps the facet b, c, bottom
+  new_a->set_neighbor(j_b, new_b);
+  new_a->set_neighbor(j_c, new_c);
+  new_a->set_neighbor(mirror, n_1_a);
+
+  // new_b: a, bottom, c, top
+  new_b->set_neighbor(i_a, new_a);
+  new_b->set_neighbor(i_b, n_1_b);
+  new_b->set_neighbor(i_c, new_c);
+  new_b->set_neighbor(facet, n_2_b);
+
+  n_2_c->set_neighbor(m_2_c, new_c);
+  n_1_a->set_neighbor(m_1_a, new_a);
+  n_1_b->set_neighbor(m_1_b, new_b);
+  n_2_b->set_neighbor(m_2_b, new_b);
+
+  reset_info(new_c);
+  reset_info(new_a);
+  reset_info(new_b);
+  for (auto const& vertex : {a, b, top, bottom}) { vertex->set_cell(new_c); }
+  c->set_cell(new_a);
+
+  return Result{
+      Move_type::TWO_THREE, Flip_status::SUCCESS, {new_c, new_a, new_b}
+  };
+}  // two_three_move()
+
+/// @brief Replace an edge with 3 incident cells by a facet, turning 3 cells
+/// into 2
+/// @details With edge endpoints top and bottom and ring vertices a, b, c,
+/// old_x being the incident cell without x, the new cells are:
+/// - The upper cell a, b, c, top: old_c with bottom replaced by c (reused)
+/// - The lower cell a, b, c, bottom: old_a with top replaced by a (reused)
+/// and old_b is deleted.
+/// @param triangulation The triangulation to modify
+/// @param edge The edge to remove
+/// @return The 2 new cells, or why the move was rejected
+template <typename Triangulation>
+auto three_two_move(Triangulation&                      triangulation,
+                    Edge_handle_t<Triangulation> const& edge)
+    -> Basic_move_result<Triangulation>
+{
+  using Cell_handle_type   = Cell_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Result             = Basic_move_result<Triangulation>;
+
+  if (triangulation.dimension() != 3 ||
+      !triangulation.tds().is_valid(edge.first, edge.second, edge.third))
+  {
+    return Result{Move_type::THREE_TWO, Flip_status::INVALID_EDGE};
+  }
+
+  std::array<Cell_handle_type, 3> incident;
+  std::size_t                     count = 0;
+  auto circulator = triangulation.incident_cells(edge, edge.first);
+  do {
+    if (count == incident.size() || triangulation.is_infinite(circulator))
+    {
+      return Result{Move_type::THREE_TWO, Flip_status::WRONG_VALENCE};
+    }
+    incident[count++] = circulator;
+  }
+  while (++circulator != edge.first);
+  if (count != incident.size())
+  {
+    return Result{Move_type::THREE_TWO, Flip_status::WRONG_VALENCE};
+  }
+
+  auto const top    = edge.first->vertex(edge.second);
+  auto const bottom = edge.first->vertex(edge.third);
+  // The ring vertex each incident cell does not contain; a cell around the
+  // edge contains the 2 ring vertices of the facets it shares with the others
+  auto const missing = [&](Cell_handle_type const& cell) {
+    auto const other = cell == incident[0] ? incident[1] : incident[0];
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const vertex = other->vertex(i);
+      if (vertex != top && vertex != bottom && !cell->has_vertex(vertex))
+      {
+        return vertex;
+      }
+    }
+    return Vertex_handle_type{};
+  };
+  auto const& [old_c, old_a, old_b] = incident;
+  auto const c                       = missing(old_c);
+  auto const a                       = missing(old_a);
+  auto const b                       = missing(old_b);
+  if (find_incident_cell(a, [&](Cell_handle_type const& cell) {
+        return cell->has_vertex(b) && cell->has_vertex(c);
+      }))
+  {
+    return Result{Move_type::THREE_TWO, Flip_status::FACET_EXISTS};
+  }
+
+  // Exterior neighbors across the facets containing top (1) or bottom (2)
+  auto const exterior = [&triangulation](Cell_handle_type const&   cell,
+                                         Vertex_handle_type const& opposite) {
+    auto const index = cell->index(opposite);
+    return std::make_pair(cell->neighbor(index),
+                          triangulation.mirror_index(cell, index));
+  };
+  auto const [n_1_a, m_1_a] = exterior(old_a, bottom);
+  auto const [n_1_b, m_1_b] = exterior(old_b, bottom);
+  auto const [n_2_b, m_2_b] = exterior(old_b, top);
+  auto const [n_2_c, m_2_c] = exterior(old_c, top);
+
+  auto const upper = old_c;
+  auto const lower = old_a;
+  upper->set_vertex(upper->index(bottom), c);
+  lower->set_vertex(lower->index(top), a);
+
+  // upper keeps the facet a, b, top; lower keeps b, c, bottom
+  upper->set_neighbor(upper->index(a), n_1_a);
+  upper->set_neighbor(upper->index(b), n_1_b);
+  upper->set_neighbor(upper->index(top), lower);
+  lower->set_neighbor(lower->index(b), n_2_b);
+  lower->set_neighbor(lower->index(c), n_2_c);
+  lower->set_neighbor(lower->index(bottom), upper);
+
+  n_1_a->set_neighbor(m_1_a, upper);
+  n_1_b->set_neighbor(m_1_b, upper);
+  n_2_b->set_neighbor(m_2_b, lower);
+  n_2_c->set_neighbor(m_2_c, lower);
+
+  reset_info(upper);
+  reset_info(lower);
+  for (auto const& vertex : {a, b, c, top}) { vertex->set_cell(upper); }
+  bottom->set_cell(lower);
+  triangulation.tds().delete_cell(old_b);
+
+  return Result{Move_type::THREE_TWO, Flip_status::SUCCESS, {upper, lower}};
+}  // three_two_move()
+
+/// @brief A stack of moves that can be rolled back to a checkpoint
+/// @details Unlike Flip_journal, which restores cells slot by slot, moves
+/// here create and delete cells, so each record names the simplex its
+/// inverse acts on by vertices, and the inverse is applied to wherever that
+/// simplex is found. Undoing restores the same triangulation, though cells
+/// may have new handles, and a vertex removed by a 4-1 move is recreated
+/// with a new handle, which is substituted in the remaining records.
+template <typename Triangulation>
+class Basic_move_journal
+{
+ public:
+  using Cell_handle_type   = Cell_handle_t<Triangulation>;
+  using Edge_handle_type   = Edge_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Point_type         = typename Triangulation::Point;
+  using Result             = Basic_move_result<Triangulation>;
+
+  /// @brief What is needed to undo one move
+  struct Record
+  {
+    /// The move that undoes the recorded one
+    Move_type                    inverse{Move_type::FOUR_FOUR};
+    /// The simplex the inverse acts on; for 4-4, the pivot edge then top
+    /// and bottom
+    std::array<Vertex_handle_type, 4> vertices{};
+    /// The vertex removed by a 4-1 move, with its point and info
+    Vertex_handle_type                removed{};
+    Point_type                        point{};
+    typename Info_of<typename Triangulation::Vertex>::type info{};
+  };
+
+  /// @brief Apply a 1-4 move and record how to undo it
+  auto one_four(Triangulation& triangulation, Cell_handle_type const& cell,
+                Point_type const& point) -> Result
+  {
+    auto result = one_four_move(triangulation, cell, point);
+    if (result)
+    {
+      m_records.push_back(Record{Move_type::FOUR_ONE, {result.vertex}});
+    }
+    return result;
+  }
+
+  /// @brief Apply a 4-1 move and record how to undo it
+  auto four_one(Triangulation& triangulation, Vertex_handle_type const& vertex)
+      -> Result
+  {
+    auto const point = vertex->point();
+    typename Info_of<typename Triangulation::Vertex>::type info{};
+    if constexpr (Has_info<typename Triangulation::Vertex>)
+    {
+      info = vertex->info();
+    }
+    auto result = four_one_move(triangulation, vertex);
+    if (result)
+    {
+      auto const& cell = result.cells.front();
+      m_records.push_back(Record{
+          Move_type::ONE_FOUR,
+          {cell->vertex(0), cell->vertex(1), cell->vertex(2), cell->vertex(3)},
+          vertex, point, info
+      });
+    }
+    return result;
+  }
+
+  /// @brief Apply a 2-3 move and record how to undo it
+  auto two_three(Triangulation& triangulation, Cell_handle_type const& cell,
+                 int facet) -> Result
+  {
+    auto result = two_three_move(triangulation, cell, facet);
+    if (result)
+    {
+      // The first new cell keeps top at the facet index
+      auto const& first = result.cells.front();
+      m_records.push_back(
+          Record{Move_type::THREE_TWO,
+                 {first->vertex(facet), first->vertex((facet + 3) & 3)}});
+    }
+    return result;
+  }
+
+  /// @brief Apply a 3-2 move and record how to undo it
+  auto three_two(Triangulation& triangulation, Edge_handle_type const& edge)
+      -> Result
+  {
+    auto const top    = edge.first->vertex(edge.second);
+    auto       result = three_two_move(triangulation, edge);
+    if (result)
+    {
+      auto const& upper = result.cells.front();
+      auto const  index = upper->index(top);
+      m_records.push_back(Record{
+          Move_type::TWO_THREE,
+          {upper->vertex((index + 1) & 3), upper->vertex((index + 2) & 3),
+           upper->vertex((index + 3) & 3)}
+      });
+    }
+    return result;
+  }
+
+  /// @brief Apply a 4-4 flip and record how to undo it
+  auto four_four(Triangulation& triangulation, Edge_handle_type const& edge,
+                 Vertex_handle_type const& top,
+                 Vertex_handle_type const& bottom) -> Result
+  {
+    auto const flip = bistellar_flip(triangulation, edge, top, bottom);
+    if (flip)
+    {
+      auto const& [cell, first, second] = flip.pivot_edge;
+      m_records.push_back(Record{
+          Move_type::FOUR_FOUR,
+          {cell->vertex(first), cell->vertex(second), top, bottom}
+      });
+    }
+    return from_flip(flip);
+  }
+
+  /// @return A checkpoint to roll back to; the number of recorded moves
+  [[nodiscard]] auto checkpoint() const noexcept -> std::size_t
+  {
+    return m_records.size();
+  }
+
+  /// @return The number of recorded moves
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_records.size();
+  }
+
+  /// @return True if there are no moves to undo
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_records.empty();
+  }
+
+  /// @brief Undo the most recent move
+  /// @details If the inverse move is rejected, nothing is changed and the
+  /// move stays recorded.
+  /// @param triangulation The modified triangulation
+  /// @return The result of the inverse move
+  auto undo(Triangulation& triangulation) -> Result
+  {
+    auto result = apply_inverse(triangulation, m_records.back());
+    if (!result) { return result; }
+    auto const record = m_records.back();
+    m_records.pop_back();
+    if (record.inverse == Move_type::ONE_FOUR)
+    {
+      if constexpr (Has_info<typename Triangulation::Vertex>)
+      {
+        result.vertex->info() = record.info;
+      }
+      for (auto& earlier : m_records)
+      {
+        std::replace(earlier.vertices.begin(), earlier.vertices.end(),
+                     record.removed, result.vertex);
+        if (earlier.removed == record.removed)
+        {
+          earlier.removed = result.vertex;
+        }
+      }
+    }
+    return result;
+  }
+
+  /// @brief Undo moves, most recent first, back to a checkpoint
+  /// @param triangulation The modified triangulation
+  /// @param checkpoint A value returned by checkpoint()
+  /// @return The number of moves undone; fewer than recorded since the
+  /// checkpoint if an inverse move is rejected, which stops the rollback
+  auto rollback(Triangulation& triangulation, std::size_t checkpoint)
+      -> std::size_t
+  {
+    std::size_t undone = 0;
+    while (m_records.size() > checkpoint)
+    {
+      if (!undo(triangulation)) { break; }
+      ++undone;
+    }
+    return undone;
+  }
+
+  /// @brief Accept all recorded moves; they can no longer be undone
+  void commit() noexcept { m_records.clear(); }
+
+ private:
+  static auto from_flip(Basic_flip_result<Triangulation> const& flip)
+      -> Result
+  {
+    if (!flip) { return Result{Move_type::FOUR_FOUR, flip.status}; }
+    return Result{Move_type::FOUR_FOUR, flip.status,
+                  {flip.cells.begin(), flip.cells.end()}};
+  }
+
+  static auto apply_inverse(Triangulation& triangulation, Record const& record)
+      -> Result
+  {
+    auto const& [first, second, third, fourth] = record.vertices;
+    // Find a cell containing the given vertices besides first
+    auto const containing = [&first](auto... others) {
+      return find_incident_cell(first, [&](Cell_handle_type const& cell) {
+        return (cell->has_vertex(others) && ...);
+      });
+    };
+
+    switch (record.inverse)
+    {
+      case Move_type::FOUR_ONE: return four_one_move(triangulation, first);
+      case Move_type::ONE_FOUR:
+      {
+        auto const cell = containing(second, third, fourth);
+        if (!cell) { break; }
+        return one_four_move(triangulation, *cell, record.point);
+      }
+      case Move_type::THREE_TWO:
+      {
+        auto const cell = containing(second);
+        if (!cell) { break; }
+        return three_two_move(
+            triangulation,
+            Edge_handle_type{*cell, (*cell)->index(first),
+                             (*cell)->index(second)});
+      }
+      case Move_type::TWO_THREE:
+      {
+        auto const cell = containing(second, third);
+        if (!cell) { break; }
+        // The vertex indices of a cell sum to 6
+        auto const facet = 6 - (*cell)->index(first) -
+                           (*cell)->index(second) - (*cell)->index(third);
+        return two_three_move(triangulation, *cell, facet);
+      }
+      case Move_type::FOUR_FOUR:
+      {
+        auto const cell = containing(second);
+        if (!cell) { break; }
+        auto const flip = bistellar_flip(
+            triangulation,
+            Edge_handle_type{*cell, (*cell)->index(first),
+                             (*cell)->index(second)},
+            third, fourth);
+        return from_flip(flip);
+      }
+    }
+    return Result{record.inverse, Flip_status::INVALID_CELL};
+  }
+
+  std::vector<Record> m_records;
+};
+
+using Move_journal = Basic_move_journal<Delaunay>;
+
+#endif  // BISTELLAR_FLIP_PACHNER_MOVES_HPP
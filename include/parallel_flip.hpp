@@ -0,0 +1,248 @@
+/// @file parallel_flip.hpp
+/// @brief Apply bistellar flips to disjoint regions on TBB worker threads
+/// @author Adam Getchell
+/// @details Each round samples candidate pivot edges, plans their flips
+/// concurrently, keeps a set of octahedral complexes that share no vertex,
+/// and applies those flips concurrently. Complexes that share no vertex
+/// share no cell either, and no exterior neighbor. Flips reuse their cells
+/// in place, so the cell container is not modified and no lock is needed.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_PARALLEL_FLIP_HPP
+#define BISTELLAR_FLIP_PARALLEL_FLIP_HPP
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "flip_engine.hpp"
+#include "flip_journal.hpp"
+#include "pivot_edge_index.hpp"
+
+/// @brief Choose plans whose octahedral complexes share no vertex
+/// @details Plans are taken greedily in order, so earlier plans win
+/// conflicts. Rejected plans are skipped.
+/// @param plans The plans to choose from
+/// @return The positions of the chosen plans
+template <typename Triangulation>
+[[nodiscard]] auto select_independent_flips(
+    std::vector<Basic_flip_plan<Triangulation>> const& plans)
+    -> std::vector<std::size_t>
+{
+  std::vector<std::size_t>                           selected;
+  std::unordered_set<Vertex_handle_t<Triangulation>> claimed;
+  for (std::size_t i = 0; i < plans.size(); ++i)
+  {
+    if (!plans[i]) { continue; }
+    auto const vertices = plans[i].vertices();
+    if (std::any_of(vertices.begin(), vertices.end(),
+                    [&claimed](auto const& vertex) {
+                      return claimed.contains(vertex);
+                    }))
+    {
+      continue;
+    }
+    claimed.insert(vertices.begin(), vertices.end());
+    selected.emplace_back(i);
+  }
+  return selected;
+}  // select_independent_flips()
+
+/// @brief Applies rounds of independent bistellar flips concurrently
+template <typename Triangulation>
+class Basic_parallel_flip_engine
+{
+ public:
+  using Edge_handle_type   = Edge_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Plan               = Basic_flip_plan<Triangulation>;
+  using Index              = Basic_pivot_edge_index<Triangulation>;
+
+  /// @brief Index the pivot edges of the triangulation
+  /// @param triangulation The triangulation to flip; must outlive the engine
+  /// @param seed Seed for choosing candidate edges and top vertices
+  explicit Basic_parallel_flip_engine(Triangulation& triangulation,
+                                      std::uint64_t  seed = 0)
+      : m_triangulation{triangulation}
+      , m_index{triangulation}
+      , m_generator{seed}
+  {}
+
+  /// @return The index of pivot edges kept by the engine
+  [[nodiscard]] auto index() const -> Index const&
+  {
+    return m_index;
+  }
+
+  /// @brief Plan flips for a batch of candidate edges and apply the
+  /// independent ones concurrently
+  /// @details Candidates that conflict with an earlier candidate in the
+  /// batch are dropped without counting as an attempt. The global check of
+  /// Flip_validation::GLOBAL walks cells that other threads are rewriting,
+  /// so the concurrent pass checks each flip locally, and the whole
+  /// triangulation is checked once, serially, after it. If that fails, every
+  /// flip of the round is undone and rejected as Flip_status::INVALID_CELL.
+  /// @param candidates How many candidate edges to sample
+  /// @param report Flips, attempts and rejections are added to it
+  /// @param validation How each flip is checked; see apply_flip()
+  /// @return The number of successful flips
+  auto round(std::size_t candidates, Flip_report& report,
+             Flip_validation validation = Flip_validation::LOCAL)
+      -> std::size_t
+  {
+    // Sampling and the choice of top and bottom use one generator, so they
+    // stay on this thread and the result depends only on the seed
+    std::vector<Basic_vertex_pair<Vertex_handle_type>> keys;
+    std::vector<Edge_handle_type>                      edges;
+    std::vector<std::pair<Vertex_handle_type, Vertex_handle_type>>
+        tops_and_bottoms;
+    for (std::size_t i = 0; i < candidates; ++i)
+    {
+      auto const edge = m_index.sample(m_generator);
+      if (!edge) { break; }
+      auto const incident_cells = get_octahedron_cells(m_triangulation, *edge);
+      if (!incident_cells)
+      {
+        ++report.attempts;
+        ++report.rejections[static_cast<std::size_t>(
+            Flip_status::WRONG_VALENCE)];
+        continue;
+      }
+      auto const top_and_bottom =
+          choose_top_and_bottom(*incident_cells, *edge, m_generator);
+      if (!top_and_bottom)
+      {
+        ++report.attempts;
+        ++report.rejections[static_cast<std::size_t>(
+            Flip_status::WRONG_PIVOT_VERTEX_COUNT)];
+        continue;
+      }
+      keys.emplace_back(make_vertex_pair(*edge));
+      edges.emplace_back(*edge);
+      tops_and_bottoms.emplace_back(*top_and_bottom);
+    }
+
+    // Planning only reads the triangulation
+    std::vector<Plan> plans(edges.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, edges.size()),
+                      [&](auto const& range) {
+                        for (auto i = range.begin(); i != range.end(); ++i)
+                        {
+                          plans[i] = plan_flip(m_triangulation, edges[i],
+                                               tops_and_bottoms[i].first,
+                                               tops_and_bottoms[i].second);
+                        }
+                      });
+    for (auto const& plan : plans)
+    {
+      if (plan) { continue; }
+      ++report.attempts;
+      ++report.rejections[static_cast<std::size_t>(plan.status)];
+    }
+
+    auto const selected = select_independent_flips(plans);
+    auto const global   = validation == Flip_validation::GLOBAL;
+    auto const local    = global ? Flip_validation::LOCAL : validation;
+    std::vector<Basic_flip_record<Triangulation>> records;
+    if (global)
+    {
+      records.reserve(selected.size());
+      for (auto const position : selected)
+      {
+        records.emplace_back(make_flip_record(plans[position]));
+      }
+    }
+    std::vector<Basic_flip_result<Triangulation>> results(selected.size());
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, selected.size()),
+        [&](auto const& range) {
+          for (auto i = range.begin(); i != range.end(); ++i)
+          {
+            results[i] = apply_flip(m_triangulation, plans[selected[i]], local);
+          }
+        });
+    if (global && !m_triangulation.tds().is_valid(true, 1))
+    {
+      // The flips are disjoint, so they can be undone in any order
+      for (std::size_t i = 0; i < selected.size(); ++i)
+      {
+        if (!results[i]) { continue; }
+        (void)undo_flip(m_triangulation, records[i]);
+        results[i] = Basic_flip_result<Triangulation>{
+            Flip_status::INVALID_CELL};
+      }
+    }
+
+    // The index is not thread-safe, so it is updated afterwards
+    std::size_t flips = 0;
+    for (std::size_t i = 0; i < selected.size(); ++i)
+    {
+      ++report.attempts;
+      if (results[i])
+      {
+        ++flips;
+        m_index.update(m_triangulation, keys[selected[i]], results[i]);
+      }
+      else
+      {
+        ++report.rejections[static_cast<std::size_t>(results[i].status)];
+      }
+    }
+    report.flips += flips;
+    return flips;
+  }
+
+  /// @brief Run rounds until the target number of flips or the time budget
+  /// is reached
+  /// @param options When to stop, and how each flip is checked; batch_size
+  /// is the number of candidates sampled per round
+  /// @return Throughput and rejection statistics
+  auto run(Flip_engine_options const& options) -> Flip_report
+  {
+    using Clock = std::chrono::steady_clock;
+    Flip_report report;
+    report.cells_before = m_triangulation.number_of_cells();
+    auto const  start   = Clock::now();
+    std::size_t consecutive_rejections = 0;
+
+    while (report.flips < options.target_flips &&
+           consecutive_rejections < options.max_consecutive_rejections &&
+           !m_index.empty() && Clock::now() - start < options.time_budget)
+    {
+      // Never select more flips than are still wanted
+      auto const candidates =
+          std::min(options.batch_size, options.target_flips - report.flips);
+      auto const attempts = report.attempts;
+      if (round(candidates, report, options.validation) > 0)
+      {
+        consecutive_rejections = 0;
+      }
+      else
+      {
+        consecutive_rejections +=
+            std::max(report.attempts - attempts, std::size_t{1});
+      }
+    }
+
+    report.elapsed     = Clock::now() - start;
+    report.cells_after = m_triangulation.number_of_cells();
+    return report;
+  }
+
+ private:
+  Triangulation&  m_triangulation;
+  Index           m_index;
+  std::mt19937_64 m_generator;
+};
+
+using Parallel_flip_engine = Basic_parallel_flip_engine<Delaunay>;
+
+#endif  // BISTELLAR_FLIP_PARALLEL_FLIP_HPP
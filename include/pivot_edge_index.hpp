@@ -0,0 +1,267 @@
+/// @file pivot_edge_index.hpp
+/// @brief Index of the edges that can be used as pivot edges
+/// @author Adam Getchell
+/// @details Keeps every edge with exactly 4 incident cells, all finite, in a
+/// dense array, so a pivot edge can be sampled uniformly in O(1). The index
+/// is updated from the cells each flip creates, instead of rescanning all
+/// edges with get_finite_edges() and find_pivot_edge().
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_PIVOT_EDGE_INDEX_HPP
+#define BISTELLAR_FLIP_PIVOT_EDGE_INDEX_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+
+/// An edge identified by its endpoints, independent of any cell
+template <typename Vertex_handle_type>
+using Basic_vertex_pair = std::pair<Vertex_handle_type, Vertex_handle_type>;
+using Vertex_pair       = Basic_vertex_pair<Vertex_handle>;
+
+/// @return The endpoints of an edge, smallest handle first
+template <typename Vertex_handle_type>
+[[nodiscard]] auto make_vertex_pair(Vertex_handle_type const& first,
+                                    Vertex_handle_type const& second)
+    -> Basic_vertex_pair<Vertex_handle_type>
+{
+  if (second < first) { return {second, first}; }
+  return {first, second};
+}  // make_vertex_pair()
+
+/// @return The endpoints of an edge, smallest handle first
+template <typename Cell_handle_type>
+[[nodiscard]] auto make_vertex_pair(
+    CGAL::Triple<Cell_handle_type, int, int> const& edge)
+    -> Basic_vertex_pair<Vertex_handle_of<Cell_handle_type>>
+{
+  return make_vertex_pair(edge.first->vertex(edge.second),
+                          edge.first->vertex(edge.third));
+}  // make_vertex_pair()
+
+/// @brief Hash for Basic_vertex_pair so it can key unordered containers
+struct Vertex_pair_hash
+{
+  template <typename Vertex_handle_type>
+  [[nodiscard]] auto operator()(
+      Basic_vertex_pair<Vertex_handle_type> const& pair) const noexcept
+      -> std::size_t
+  {
+    auto const first  = std::hash<Vertex_handle_type>{}(pair.first);
+    auto const second = std::hash<Vertex_handle_type>{}(pair.second);
+    return first ^ (second + 0x9e3779b97f4a7c15ULL + (first << 6U) +
+                    (first >> 2U));
+  }
+};
+
+/// @brief The change in the number of pivot edges a planned flip would make
+/// @details The new cells are all finite. The old pivot edge is removed and
+/// the new one has 4 finite cells, so those cancel. The only other edges
+/// whose cells change are the 8 joining top or bottom to the old and new
+/// pivot vertices, which lose or gain one cell each (see Star_cache). Each
+/// is an edge of an old cell, so it is recounted there. Infinite cells are
+/// not touched, so an edge on the hull is a pivot edge neither before nor
+/// after.
+/// @param triangulation The triangulation the plan was made for
+/// @param plan A successful plan whose flip has not been applied
+/// @return The number of pivot edges after the flip minus before
+template <typename Triangulation>
+[[nodiscard]] auto pivot_edge_change(
+    Triangulation const&                  triangulation,
+    Basic_flip_plan<Triangulation> const& plan) -> int
+{
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  auto const recount = [&](Vertex_handle_type const& first,
+                           Vertex_handle_type const& second, int cells) {
+    auto const cell = *std::find_if(
+        plan.cells.begin(), plan.cells.end(), [&](auto const& old) {
+          return old->has_vertex(first) && old->has_vertex(second);
+        });
+    Edge_handle_t<Triangulation> const edge{cell, cell->index(first),
+                                            cell->index(second)};
+    int  before     = 0;
+    auto circulator = triangulation.incident_cells(edge, cell);
+    do {
+      if (triangulation.is_infinite(circulator)) { return 0; }
+      ++before;
+    }
+    while (++circulator != cell);
+    return static_cast<int>(before + cells == 4) -
+           static_cast<int>(before == 4);
+  };
+
+  int change = 0;
+  for (auto const& end : {plan.top, plan.bottom})
+  {
+    change += recount(end, plan.pivot_from_1, -1) +
+              recount(end, plan.pivot_from_2, -1) +
+              recount(end, plan.pivot_to_1, 1) +
+              recount(end, plan.pivot_to_2, 1);
+  }
+  return change;
+}  // pivot_edge_change()
+
+/// @brief The edges with exactly 4 incident cells, all finite
+template <typename Triangulation>
+class Basic_pivot_edge_index
+{
+ public:
+  using Cell_handle_type   = Cell_handle_t<Triangulation>;
+  using Edge_handle_type   = Edge_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Vertex_pair_type   = Basic_vertex_pair<Vertex_handle_type>;
+
+  /// @brief Index all pivot edges with one pass over the finite edges
+  /// @param triangulation The triangulation to index
+  explicit Basic_pivot_edge_index(Triangulation const& triangulation)
+  {
+    for (auto const& edge : pivot_edges_view(triangulation))
+    {
+      insert(make_vertex_pair(edge), edge);
+    }
+  }
+
+  /// @return The number of pivot edges
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_edges.size();
+  }
+
+  /// @return True if there are no pivot edges
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_edges.empty(); }
+
+  /// @return True if the edge between the two vertices is a pivot edge
+  [[nodiscard]] auto contains(Vertex_handle_type const& first,
+                              Vertex_handle_type const& second) const -> bool
+  {
+    return m_positions.contains(make_vertex_pair(first, second));
+  }
+
+  /// @return The pivot edge between the two vertices, or std::nullopt
+  [[nodiscard]] auto find(Vertex_handle_type const& first,
+                          Vertex_handle_type const& second) const
+      -> std::optional<Edge_handle_type>
+  {
+    auto const position = m_positions.find(make_vertex_pair(first, second));
+    if (position == m_positions.end()) { return std::nullopt; }
+    return m_edges[position->second];
+  }
+
+  /// @return The pivot edge at the given position in the index
+  [[nodiscard]] auto operator[](std::size_t position) const
+      -> Edge_handle_type const&
+  {
+    return m_edges[position];
+  }
+
+  /// @brief Choose a pivot edge uniformly at random in O(1)
+  /// @param generator A uniform random bit generator
+  /// @return A pivot edge, or std::nullopt if there are none
+  template <typename Generator>
+  [[nodiscard]] auto sample(Generator& generator) const
+      -> std::optional<Edge_handle_type>
+  {
+    if (m_edges.empty()) { return std::nullopt; }
+    std::uniform_int_distribution<std::size_t> distribution(
+        0, m_edges.size() - 1);
+    return m_edges[distribution(generator)];
+  }
+
+  /// @brief Recount the cells of one edge and add or remove it
+  /// @param triangulation The triangulation containing the edge
+  /// @param edge The edge to recount
+  void refresh(Triangulation const& triangulation, Edge_handle_type const& edge)
+  {
+    if (triangulation.is_infinite(edge.first->vertex(edge.second)) ||
+        triangulation.is_infinite(edge.first->vertex(edge.third)))
+    {
+      return;
+    }
+    auto const key = make_vertex_pair(edge);
+    if (is_pivot_edge(triangulation, edge)) { insert(key, edge); }
+    else { erase(key); }
+  }
+
+  /// @brief Recount every edge of the given cells
+  /// @param triangulation The triangulation containing the cells
+  /// @param cells The new cells of a move
+  template <std::ranges::input_range Range>
+  void refresh(Triangulation const& triangulation, Range const& cells)
+  {
+    for (auto const& cell : cells)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        for (int j = i + 1; j < 4; ++j)
+        {
+          refresh(triangulation, Edge_handle_type{cell, i, j});
+        }
+      }
+    }
+  }
+
+  /// @brief Update the index after a successful bistellar flip
+  /// @details The old pivot edge is removed, and every edge of the 4 new
+  /// cells is recounted. These are the only edges whose valence or
+  /// incident cells can change, so the cost does not depend on the size of
+  /// the triangulation.
+  /// @param triangulation The flipped triangulation
+  /// @param old_pivot The endpoints of the edge that was flipped
+  /// @param result The result of the flip
+  void update(Triangulation const& triangulation,
+              Vertex_pair_type const&                 old_pivot,
+              Basic_flip_result<Triangulation> const& result)
+  {
+    if (!result) { return; }
+    erase(old_pivot);
+    refresh(triangulation, result.cells);
+  }
+
+  /// @brief Remove an edge, e.g. one removed from the triangulation
+  /// @param key The endpoints of the edge
+  void erase(Vertex_pair_type const& key)
+  {
+    auto const position = m_positions.find(key);
+    if (position == m_positions.end()) { return; }
+    // Move the last edge into the hole so the array stays dense
+    auto const hole = position->second;
+    m_positions.erase(position);
+    if (hole != m_edges.size() - 1)
+    {
+      m_keys[hole]              = m_keys.back();
+      m_edges[hole]             = m_edges.back();
+      m_positions[m_keys[hole]] = hole;
+    }
+    m_keys.pop_back();
+    m_edges.pop_back();
+  }
+
+ private:
+  void insert(Vertex_pair_type const& key, Edge_handle_type const& edge)
+  {
+    auto const [position, inserted] = m_positions.try_emplace(key, size());
+    if (inserted)
+    {
+      m_keys.emplace_back(key);
+      m_edges.emplace_back(edge);
+    }
+    else { m_edges[position->second] = edge; }
+  }
+
+  std::vector<Vertex_pair_type> m_keys;
+  std::vector<Edge_handle_type> m_edges;
+  std::unordered_map<Vertex_pair_type, std::size_t, Vertex_pair_hash>
+      m_positions;
+};
+
+using Pivot_edge_index = Basic_pivot_edge_index<Delaunay>;
+
+#endif  // BISTELLAR_FLIP_PIVOT_EDGE_INDEX_HPP
@@ -0,0 +1,222 @@
+/// @file point_generators.hpp
+/// @brief Reproducible random point sets and their Delaunay triangulations
+/// @author Adam Getchell
+/// @details Points are generated in fixed-size blocks on TBB worker threads.
+/// Each block has its own generator, seeded from the seed and the block
+/// number, so the points depend only on the seed and never on the number of
+/// threads. make_delaunay() sorts the points along a Hilbert curve in
+/// biased randomized rounds (BRIO), also in parallel when CGAL is linked
+/// with TBB, and inserts each point starting from the cell of the one
+/// before, so point location walks only a few cells.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_POINT_GENERATORS_HPP
+#define BISTELLAR_FLIP_POINT_GENERATORS_HPP
+
+#include <CGAL/spatial_sort.h>
+#include <CGAL/tags.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+
+/// @brief The shape of a random point set
+enum class Point_distribution
+{
+  /// Uniform in the unit cube [0, 1)^3
+  CUBE,
+  /// Uniform in the unit ball
+  BALL,
+  /// Uniform in the spherical shell between SHELL_INNER_RADIUS and 1
+  SHELL,
+  /// A cubic lattice filling the unit cube, each point moved by up to
+  /// LATTICE_JITTER of the spacing along each axis so no 5 are cospherical
+  LATTICE
+};
+
+/// The inner radius of Point_distribution::SHELL
+inline constexpr double SHELL_INNER_RADIUS = 0.8;
+
+/// The largest displacement of a lattice point, as a fraction of the spacing
+inline constexpr double LATTICE_JITTER = 0.25;
+
+/// The number of points generated from one seed, and so by one task
+inline constexpr std::size_t POINT_BLOCK_SIZE = 4096;
+
+/// @return A human-readable name for a point distribution
+[[nodiscard]] inline auto to_string(Point_distribution distribution)
+    -> std::string
+{
+  switch (distribution)
+  {
+    case Point_distribution::CUBE: return "cube";
+    case Point_distribution::BALL: return "ball";
+    case Point_distribution::SHELL: return "shell";
+    case Point_distribution::LATTICE: return "lattice";
+  }
+  return "unknown";
+}  // to_string()
+
+/// @return The point distribution with the given name, or std::nullopt
+[[nodiscard]] inline auto parse_point_distribution(std::string_view name)
+    -> std::optional<Point_distribution>
+{
+  for (auto const distribution :
+       {Point_distribution::CUBE, Point_distribution::BALL,
+        Point_distribution::SHELL, Point_distribution::LATTICE})
+  {
+    if (to_string(distribution) == name) { return distribution; }
+  }
+  return std::nullopt;
+}  // parse_point_distribution()
+
+/// @brief Derive independent seeds from one seed
+/// @details The SplitMix64 finalizer, so nearby blocks get unrelated seeds
+/// @param seed The seed of the whole point set
+/// @param stream The number of the block
+/// @return The seed of the block
+[[nodiscard]] inline auto mix_seed(std::uint64_t seed, std::uint64_t stream)
+    -> std::uint64_t
+{
+  auto z = seed + (stream + 1) * 0x9E3779B97F4A7C15ULL;
+  z      = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  z      = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31U);
+}  // mix_seed()
+
+/// @brief A point uniform in the spherical shell between two radii
+/// @param generator The generator of the block
+/// @param inner_radius The inner radius, 0 for the ball
+/// @return A point with norm in [inner_radius, 1)
+template <typename Generator>
+[[nodiscard]] auto random_point_in_shell(Generator& generator,
+                                         double     inner_radius) -> Point
+{
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  // Uniform direction from a uniform height and azimuth (Archimedes)
+  auto const height  = 2.0 * unit(generator) - 1.0;
+  auto const azimuth = 2.0 * std::numbers::pi * unit(generator);
+  auto const ring    = std::sqrt(1.0 - height * height);
+  // Volume grows as r^3, so invert the radial distribution function
+  auto const inner_cubed = inner_radius * inner_radius * inner_radius;
+  auto const radius =
+      std::cbrt(inner_cubed + (1.0 - inner_cubed) * unit(generator));
+  return {radius * ring * std::cos(azimuth), radius * ring * std::sin(azimuth),
+          radius * height};
+}  // random_point_in_shell()
+
+/// @brief Generate a reproducible random point set in parallel
+/// @param distribution The shape of the point set
+/// @param number_of_points The number of points
+/// @param seed The same seed gives the same points on any number of threads
+/// @return The points, in generation order
+[[nodiscard]] inline auto generate_points(Point_distribution distribution,
+                                          std::size_t        number_of_points,
+                                          std::uint64_t      seed)
+    -> std::vector<Point>
+{
+  std::vector<Point> points(number_of_points);
+  // Lattice points are numbered along x, then y, then z
+  auto const side = static_cast<std::size_t>(
+      std::ceil(std::cbrt(static_cast<double>(number_of_points))));
+  auto const spacing = side == 0 ? 1.0 : 1.0 / static_cast<double>(side);
+  auto const blocks =
+      (number_of_points + POINT_BLOCK_SIZE - 1) / POINT_BLOCK_SIZE;
+
+  tbb::parallel_for(
+      tbb::blocked_range<std::size_t>(0, blocks), [&](auto const& range) {
+        for (auto block = range.begin(); block != range.end(); ++block)
+        {
+          std::mt19937_64 generator(mix_seed(seed, block));
+          std::uniform_real_distribution<double> unit(0.0, 1.0);
+          std::uniform_real_distribution<double> jitter(-LATTICE_JITTER,
+                                                        LATTICE_JITTER);
+          auto const first = block * POINT_BLOCK_SIZE;
+          auto const last =
+              std::min(first + POINT_BLOCK_SIZE, number_of_points);
+          for (auto i = first; i < last; ++i)
+          {
+            switch (distribution)
+            {
+              case Point_distribution::CUBE:
+              {
+                auto const x = unit(generator);
+                auto const y = unit(generator);
+                points[i]    = Point(x, y, unit(generator));
+                break;
+              }
+              case Point_distribution::BALL:
+                points[i] = random_point_in_shell(generator, 0.0);
+                break;
+              case Point_distribution::SHELL:
+                points[i] =
+                    random_point_in_shell(generator, SHELL_INNER_RADIUS);
+                break;
+              case Point_distribution::LATTICE:
+              {
+                auto const coordinate = [&](std::size_t index) {
+                  return (static_cast<double>(index) + 0.5 +
+                          jitter(generator)) *
+                         spacing;
+                };
+                auto const x = coordinate(i % side);
+                auto const y = coordinate(i / side % side);
+                points[i]    = Point(x, y, coordinate(i / side / side));
+                break;
+              }
+            }
+          }
+        }
+      });
+  return points;
+}  // generate_points()
+
+/// @brief Build a Delaunay triangulation by hinted insertion in spatial
+/// order
+/// @details The points are sorted in place. Hilbert sorting runs on TBB
+/// worker threads if CGAL is configured with TBB support.
+/// @tparam Triangulation A Delaunay triangulation type, e.g. from
+/// triangulation_config.hpp
+/// @param points The points to insert
+/// @return The Delaunay triangulation of the points
+template <typename Triangulation = Delaunay>
+[[nodiscard]] auto make_delaunay(std::vector<Point>& points) -> Triangulation
+{
+  CGAL::spatial_sort<CGAL::Parallel_if_available_tag>(points.begin(),
+                                                      points.end());
+  Triangulation                       triangulation;
+  typename Triangulation::Cell_handle hint;
+  for (auto const& point : points)
+  {
+    hint = triangulation.insert(point, hint)->cell();
+  }
+  return triangulation;
+}  // make_delaunay()
+
+/// @brief Generate a reproducible random point set and triangulate it
+/// @param distribution The shape of the point set
+/// @param number_of_points The number of points
+/// @param seed The same seed gives the same triangulation
+/// @return The Delaunay triangulation of the points
+template <typename Triangulation = Delaunay>
+[[nodiscard]] auto make_random_delaunay(Point_distribution distribution,
+                                        std::size_t        number_of_points,
+                                        std::uint64_t      seed)
+    -> Triangulation
+{
+  auto points = generate_points(distribution, number_of_points, seed);
+  return make_delaunay<Triangulation>(points);
+}  // make_random_delaunay()
+
+#endif  // BISTELLAR_FLIP_POINT_GENERATORS_HPP
@@ -0,0 +1,160 @@
+/// @file relayout.hpp
+/// @brief Reorder vertex and cell storage along a Hilbert curve
+/// @author Adam Getchell
+/// @details Flips rewrite cells in place, and Delaunay repair and the n-to-m
+/// moves delete and create cells, so after millions of moves cells that are
+/// neighbors in the mesh are far apart in the Compact_container. relayout()
+/// copies the triangulation into fresh storage with vertices in Hilbert
+/// order of their points and cells in Hilbert order of their centroids, so
+/// walks around edges and vertices touch nearby memory again.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_RELAYOUT_HPP
+#define BISTELLAR_FLIP_RELAYOUT_HPP
+
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/property_map.h>
+
+#include <cstddef>
+#include <numeric>
+#include <unordered_map>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "triangulation_config.hpp"
+
+/// @brief The order of points along a Hilbert curve
+/// @tparam Kernel The geometric kernel of the points
+/// @param points The points to order
+/// @return The positions of the points, in Hilbert order
+template <typename Kernel, typename Triangulation_point>
+[[nodiscard]] auto hilbert_order(std::vector<Triangulation_point> const& points)
+    -> std::vector<std::size_t>
+{
+  using Point_map =
+      typename CGAL::Pointer_property_map<Triangulation_point>::const_type;
+
+  std::vector<std::size_t> order(points.size());
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  CGAL::hilbert_sort(
+      order.begin(), order.end(),
+      CGAL::Spatial_sort_traits_adapter_3<Kernel, Point_map>(
+          CGAL::make_property_map(points)));
+  return order;
+}  // hilbert_order()
+
+/// @brief Renumber and physically reorder vertices and cells along a
+/// Hilbert curve
+/// @details Builds a copy of the triangulation in Hilbert order and swaps
+/// it in, so there must be room for a second copy while it runs. The
+/// infinite vertex comes first. An infinite cell is placed by the centroid
+/// of its finite vertices, next to its finite neighbor. Points and infos
+/// are copied, so the triangulation is the same, but every vertex, cell and
+/// edge handle into it is invalidated; rebuild indices such as
+/// Pivot_edge_index afterwards.
+/// @param triangulation The triangulation to reorder
+/// @return True if reordered, false if the dimension is not 3
+template <typename Triangulation>
+auto relayout(Triangulation& triangulation) -> bool
+{
+  using Kernel              = typename Triangulation::Geom_traits;
+  using Triangulation_point = typename Triangulation::Point;
+  using Old_vertex          = Vertex_handle_t<Triangulation>;
+  using Old_cell            = Cell_handle_t<Triangulation>;
+
+  auto const& tds = triangulation.tds();
+  if (tds.dimension() != 3) { return false; }
+
+  // Vertices in Hilbert order of their points
+  std::vector<Old_vertex>          vertices;
+  std::vector<Triangulation_point> points;
+  vertices.reserve(triangulation.number_of_vertices());
+  points.reserve(triangulation.number_of_vertices());
+  for (auto const& vertex : finite_vertices_view(triangulation))
+  {
+    vertices.emplace_back(vertex);
+    points.emplace_back(vertex->point());
+  }
+  auto const vertex_order = hilbert_order<Kernel>(points);
+
+  // Cells in Hilbert order of the centroids of their finite vertices
+  std::vector<Old_cell> cells;
+  cells.reserve(tds.number_of_cells());
+  points.clear();
+  for (auto cell = tds.cells_begin(); cell != tds.cells_end(); ++cell)
+  {
+    double x     = 0.0;
+    double y     = 0.0;
+    double z     = 0.0;
+    double count = 0.0;
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const& vertex = cell->vertex(i);
+      if (triangulation.is_infinite(vertex)) { continue; }
+      x += vertex->point().x();
+      y += vertex->point().y();
+      z += vertex->point().z();
+      count += 1.0;
+    }
+    cells.emplace_back(cell);
+    points.emplace_back(x / count, y / count, z / count);
+  }
+  auto const cell_order = hilbert_order<Kernel>(points);
+  points                = std::vector<Triangulation_point>{};
+
+  // Reserving first gives one contiguous block in each container
+  Triangulation relaid;
+  auto&         new_tds = relaid.tds();
+  new_tds.clear();
+  new_tds.vertices().reserve(tds.number_of_vertices());
+  new_tds.cells().reserve(tds.number_of_cells());
+
+  std::unordered_map<Old_vertex, Vertex_handle_t<Triangulation>> new_vertex;
+  new_vertex.reserve(tds.number_of_vertices());
+  auto const copy_vertex = [&](Old_vertex const& vertex) {
+    auto const copy = new_tds.create_vertex();
+    copy->set_point(vertex->point());
+    if constexpr (Has_info<typename Triangulation::Vertex>)
+    {
+      copy->info() = vertex->info();
+    }
+    new_vertex.emplace(vertex, copy);
+  };
+  copy_vertex(triangulation.infinite_vertex());
+  for (auto const position : vertex_order) { copy_vertex(vertices[position]); }
+
+  std::unordered_map<Old_cell, Cell_handle_t<Triangulation>> new_cell;
+  new_cell.reserve(tds.number_of_cells());
+  for (auto const position : cell_order)
+  {
+    auto const& cell = cells[position];
+    auto const  copy = new_tds.create_cell();
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const& vertex = new_vertex.at(cell->vertex(i));
+      copy->set_vertex(i, vertex);
+      vertex->set_cell(copy);
+    }
+    if constexpr (Has_info<typename Triangulation::Cell>)
+    {
+      copy->info() = cell->info();
+    }
+    new_cell.emplace(cell, copy);
+  }
+  for (auto const& cell : cells)
+  {
+    auto const& copy = new_cell.at(cell);
+    for (int i = 0; i < 4; ++i)
+    {
+      copy->set_neighbor(i, new_cell.at(cell->neighbor(i)));
+    }
+  }
+
+  new_tds.set_dimension(3);
+  relaid.set_infinite_vertex(new_vertex.at(triangulation.infinite_vertex()));
+  triangulation.swap(relaid);
+  return true;
+}  // relayout()
+
+#endif  // BISTELLAR_FLIP_RELAYOUT_HPP
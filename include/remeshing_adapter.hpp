@@ -0,0 +1,104 @@
+/// @file remeshing_adapter.hpp
+/// @brief Share one triangulation between Delaunay_triangulation_3 and
+/// Remeshing_triangulation_3
+/// @author Adam Getchell
+/// @details CGAL's tetrahedral remeshing, and flip_n_to_m in particular,
+/// works on a Remeshing_triangulation_3 inside a
+/// Mesh_complex_3_in_triangulation_3. Converting a Delaunay triangulation
+/// through a tetrahedron soup would copy every cell and vertex. Instead, both
+/// triangulation types here are built on the same triangulation data
+/// structure, so they share a Triangulation_3 base, and the adapter lends
+/// the cells and vertices from one to the other by swapping pointers.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_REMESHING_ADAPTER_HPP
+#define BISTELLAR_FLIP_REMESHING_ADAPTER_HPP
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Mesh_complex_3_in_triangulation_3.h>
+#include <CGAL/Tetrahedral_remeshing/Remeshing_triangulation_3.h>
+#include <CGAL/Triangulation_3.h>
+
+#include <type_traits>
+
+#include "bistellar_flip.hpp"
+#include "incident_cells_cache.hpp"
+
+/// Our vertex and cell bases, with the data remeshing needs added
+using Remeshing_vb =
+    CGAL::Tetrahedral_remeshing::Remeshing_vertex_base_3<K, Vb>;
+using Remeshing_cb = CGAL::Tetrahedral_remeshing::Remeshing_cell_base_3<K, Cb>;
+using Remeshing_triangulation =
+    CGAL::Tetrahedral_remeshing::Remeshing_triangulation_3<
+        K, CGAL::Sequential_tag, Remeshing_vb, Remeshing_cb>;
+using Remeshing_tds = Remeshing_triangulation::Triangulation_data_structure;
+/// A Delaunay triangulation that can be lent to tetrahedral remeshing
+using Remeshable_delaunay = CGAL::Delaunay_triangulation_3<K, Remeshing_tds>;
+using Remeshing_complex =
+    CGAL::Mesh_complex_3_in_triangulation_3<Remeshing_triangulation>;
+using Remeshing_incident_cells_cache =
+    Incident_cells_cache<Remeshing_triangulation>;
+
+/// The part both triangulations have in common: the data structure, the
+/// infinite vertex and the traits
+using Shared_triangulation_base = CGAL::Triangulation_3<K, Remeshing_tds>;
+static_assert(
+    std::is_base_of_v<Shared_triangulation_base, Remeshable_delaunay>);
+static_assert(
+    std::is_base_of_v<Shared_triangulation_base, Remeshing_triangulation>);
+
+/// @brief Lends a Delaunay triangulation to tetrahedral remeshing without
+/// copying it
+/// @details For the lifetime of the adapter, the triangulation is swapped
+/// into a Remeshing_triangulation_3 inside a remeshing complex, and the
+/// Delaunay triangulation is empty. Swapping exchanges the data structures'
+/// containers, so no cell or vertex is copied and handles stay valid. The
+/// destructor swaps them back. Remeshing only changes cells that are in the
+/// complex, so every finite cell is added to it, which sets the subdomain
+/// index stored in each cell.
+class Remeshing_adapter
+{
+ public:
+  using Subdomain_index = Remeshing_complex::Subdomain_index;
+
+  /// @brief Lend the triangulation to remeshing
+  /// @param triangulation The triangulation; must outlive the adapter
+  /// @param subdomain The subdomain the finite cells are added to
+  explicit Remeshing_adapter(Remeshable_delaunay& triangulation,
+                             Subdomain_index      subdomain = 1)
+      : m_delaunay{triangulation}
+  {
+    swap_triangulations();
+    for (auto const cell : m_complex.triangulation().finite_cell_handles())
+    {
+      m_complex.add_to_complex(cell, subdomain);
+    }
+  }
+
+  Remeshing_adapter(Remeshing_adapter const&)                    = delete;
+  auto operator=(Remeshing_adapter const&) -> Remeshing_adapter& = delete;
+
+  /// @brief Give the triangulation back, with any changes made to it
+  ~Remeshing_adapter() { swap_triangulations(); }
+
+  /// @return The lent triangulation, viewed as a remeshing triangulation
+  [[nodiscard]] auto triangulation() -> Remeshing_triangulation&
+  {
+    return m_complex.triangulation();
+  }
+
+  /// @return The remeshing complex holding the lent triangulation
+  [[nodiscard]] auto complex() -> Remeshing_complex& { return m_complex; }
+
+ private:
+  void swap_triangulations()
+  {
+    static_cast<Shared_triangulation_base&>(m_delaunay).swap(
+        m_complex.triangulation());
+  }
+
+  Remeshable_delaunay& m_delaunay;
+  Remeshing_complex    m_complex;
+};
+
+#endif  // BISTELLAR_FLIP_REMESHING_ADAPTER_HPP
@@ -0,0 +1,327 @@
+/// @file replica_runner.hpp
+/// @brief Flip many triangulations at different couplings in one process
+/// @author Adam Getchell
+/// @details A Replica_runner keeps one Delaunay triangulation and one
+/// Flip_engine per coupling. The replicas are built concurrently. Each
+/// runs its sweeps as a single TBB task, and an affinity_partitioner keeps
+/// each replica on the same worker thread from one round to the next.
+/// Every flip is accepted by Metropolis-Hastings at the replica's coupling,
+/// with an action of the running degree and valence sums kept by a
+/// Star_cache.
+/// Between rounds, replicas at neighboring couplings may exchange couplings
+/// by parallel tempering. Only their parameters are swapped; the meshes
+/// stay where they are.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_REPLICA_RUNNER_HPP
+#define BISTELLAR_FLIP_REPLICA_RUNNER_HPP
+
+#include <fmt/core.h>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "flip_engine.hpp"
+#include "point_generators.hpp"
+
+/// @brief Add the statistics of a later batch of flips to a running total
+/// @param total The statistics so far
+/// @param report The statistics of the later batch
+inline void accumulate_report(Flip_report& total, Flip_report const& report)
+{
+  if (total.attempts == 0 && total.cells_before == 0)
+  {
+    total.cells_before = report.cells_before;
+  }
+  total.flips += report.flips;
+  total.attempts += report.attempts;
+  for (std::size_t i = 0; i < FLIP_STATUS_COUNT; ++i)
+  {
+    total.rejections[i] += report.rejections[i];
+  }
+  total.cells_after = report.cells_after;
+  total.relayouts += report.relayouts;
+  total.snapshots += report.snapshots;
+  total.elapsed += report.elapsed;
+}  // accumulate_report()
+
+/// @brief One triangulation and the engine that flips it
+struct Replica
+{
+  /// @param initial The triangulation to flip
+  /// @param seed Seed of the engine and of the acceptance test
+  Replica(Delaunay initial, std::uint64_t seed)
+      : triangulation{std::move(initial)}
+      , engine{triangulation, seed}
+      , generator{mix_seed(seed, 1)}
+  {
+    static_cast<void>(engine.track_stars());
+  }
+
+  /// @brief Metropolis-Hastings acceptance of a planned flip at a coupling
+  /// @details The engine proposes a flip by drawing one of the N pivot
+  /// edges uniformly and one of its 2 other diagonals, and the reverse
+  /// flip is proposed from the N' pivot edges after it. A flip that
+  /// changes the action by dS is therefore accepted with probability
+  /// min(1, N / N' * exp(-coupling * dS)), so the replica samples
+  /// exp(-coupling * S). This needs each candidate to be drawn from the
+  /// current index, so Replica_runner::run() sweeps with a batch_size of 1.
+  /// @tparam Action Callable as double(Star_sums const&)
+  /// @param plan A successful plan for this replica's triangulation
+  /// @param coupling The coupling of the replica
+  /// @param action The action of a triangulation with the given sums
+  /// @return Whether to make the flip
+  template <typename Action>
+  auto accept(Flip_plan const& plan, double coupling, Action& action) -> bool
+  {
+    auto const& stars  = *engine.stars();
+    auto const  before = stars.sums();
+    auto const  change = action(before + stars.delta(plan)) - action(before);
+    auto const  pivots = static_cast<double>(engine.index().size());
+    auto const  ratio =
+        pivots / (pivots + pivot_edge_change(triangulation, plan));
+    auto const probability = ratio * std::exp(-coupling * change);
+    if (probability >= 1.0) { return true; }
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    return unit(generator) < probability;
+  }
+
+  Delaunay        triangulation;
+  Flip_engine     engine;
+  /// Draws the Metropolis acceptance tests
+  std::mt19937_64 generator;
+  /// The position of its coupling in Replica_runner::couplings()
+  std::size_t     parameter{};
+};
+
+/// @brief How long to run the replicas, and how often to exchange
+struct Replica_runner_options
+{
+  /// When to stop each sweep of each replica, and how each flip is checked;
+  /// batch_size is always 1, see Replica_runner::run()
+  Flip_engine_options sweep;
+  /// The number of sweeps of every replica
+  std::size_t         sweeps{1};
+  /// Attempt exchanges after every this many sweeps, or never if 0
+  std::size_t         exchange_interval{1};
+};
+
+/// @brief Aggregate throughput and exchange statistics of a run
+struct Replica_report
+{
+  /// The statistics of every sweep of each replica, by replica
+  std::vector<Flip_report>      replicas;
+  std::size_t                   exchanges_attempted{};
+  std::size_t                   exchanges_accepted{};
+  /// Wall-clock time of the whole run
+  std::chrono::duration<double> elapsed{};
+
+  /// @return Successful flips over all replicas
+  [[nodiscard]] auto flips() const -> std::size_t
+  {
+    return std::accumulate(
+        replicas.begin(), replicas.end(), std::size_t{0},
+        [](std::size_t sum, auto const& report) { return sum + report.flips; });
+  }
+
+  /// @return Successful flips over all replicas per second of wall-clock
+  /// time
+  [[nodiscard]] auto flips_per_second() const -> double
+  {
+    if (elapsed.count() <= 0.0) { return 0.0; }
+    return static_cast<double>(flips()) / elapsed.count();
+  }
+};
+
+/// @brief Print a replica report in human-readable form.
+/// @param report The report to print.
+inline void print_replica_report(Replica_report const& report)
+{
+  fmt::print("Flips: {} over {} replicas in {:.3f} s ({:.0f} flips/s)\n",
+             report.flips(), report.replicas.size(), report.elapsed.count(),
+             report.flips_per_second());
+  for (std::size_t i = 0; i < report.replicas.size(); ++i)
+  {
+    fmt::print("  Replica {}: {} of {} attempts ({:.0f} flips/s)\n", i,
+               report.replicas[i].flips, report.replicas[i].attempts,
+               report.replicas[i].flips_per_second());
+  }
+  if (report.exchanges_attempted > 0)
+  {
+    fmt::print("Exchanges: {} of {} accepted\n", report.exchanges_accepted,
+               report.exchanges_attempted);
+  }
+}  // print_replica_report()
+
+/// @brief Runs the flip loops of several replicas concurrently, with
+/// parallel-tempering exchanges of their couplings
+class Replica_runner
+{
+ public:
+  /// @brief Triangulate one random point set per coupling, concurrently
+  /// @details Replica i starts at coupling i.
+  /// @param couplings The coupling of each replica, in the order in which
+  /// neighbors exchange
+  /// @param distribution The shape of the point sets
+  /// @param number_of_points The number of points of each replica
+  /// @param seed Seed for the point sets, the engines and the exchanges
+  Replica_runner(std::vector<double> couplings,
+                 Point_distribution  distribution,
+                 std::size_t         number_of_points,
+                 std::uint64_t       seed)
+      : m_couplings{std::move(couplings)}
+      , m_replicas(m_couplings.size())
+      , m_replica_at(m_couplings.size())
+      , m_generator{seed}
+  {
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, m_replicas.size(), 1),
+        [&](auto const& range) {
+          for (auto i = range.begin(); i != range.end(); ++i)
+          {
+            m_replicas[i] = std::make_unique<Replica>(
+                make_random_delaunay(distribution, number_of_points,
+                                     mix_seed(seed, 2 * i)),
+                mix_seed(seed, 2 * i + 1));
+            m_replicas[i]->parameter = i;
+          }
+        });
+    std::iota(m_replica_at.begin(), m_replica_at.end(), std::size_t{0});
+  }
+
+  /// @return The couplings, in the order in which neighbors exchange
+  [[nodiscard]] auto couplings() const -> std::vector<double> const&
+  {
+    return m_couplings;
+  }
+
+  /// @return The number of replicas
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_replicas.size();
+  }
+
+  /// @return Replica i, which keeps its triangulation across exchanges
+  [[nodiscard]] auto replica(std::size_t i) const -> Replica const&
+  {
+    return *m_replicas[i];
+  }
+
+  /// @return The replica currently at coupling i
+  [[nodiscard]] auto replica_at(std::size_t i) const -> Replica const&
+  {
+    return *m_replicas[m_replica_at[i]];
+  }
+
+  /// @brief Run sweeps on every replica concurrently, exchanging
+  /// couplings between rounds
+  /// @details Each replica accepts flips by Metropolis-Hastings at its
+  /// coupling; see Replica::accept(). Replicas at couplings b and c, with
+  /// actions S and T, exchange with probability min(1, exp((b - c)(S - T))),
+  /// so each coupling keeps sampling exp(-bS). Even and odd pairs of
+  /// neighboring couplings alternate from one round to the next. Sweeps
+  /// queue one candidate at a time whatever options.sweep.batch_size is,
+  /// since a batch drawn ahead would be proposed from a stale index.
+  /// @tparam Action Callable as double(Star_sums const&); called
+  /// concurrently on different replicas
+  /// @param options How long to run, and how often to exchange
+  /// @param action The action of a replica from its degree and valence
+  /// sums, e.g. a weighted sum of them
+  /// @return Throughput of each replica and exchange statistics
+  template <typename Action>
+  auto run(Replica_runner_options const& options, Action&& action)
+      -> Replica_report
+  {
+    using Clock = std::chrono::steady_clock;
+    Replica_report report;
+    report.replicas.resize(m_replicas.size());
+    auto const start = Clock::now();
+
+    auto sweep_options       = options.sweep;
+    sweep_options.batch_size = 1;
+
+    std::vector<double> actions(m_replicas.size());
+    for (std::size_t done = 0; done < options.sweeps;)
+    {
+      auto const sweeps =
+          options.exchange_interval == 0
+              ? options.sweeps - done
+              : std::min(options.exchange_interval, options.sweeps - done);
+      // One task per replica, so no two threads share a triangulation
+      tbb::parallel_for(
+          tbb::blocked_range<std::size_t>(0, m_replicas.size(), 1),
+          [&](auto const& range) {
+            for (auto i = range.begin(); i != range.end(); ++i)
+            {
+              auto&      replica    = *m_replicas[i];
+              auto const coupling   = m_couplings[replica.parameter];
+              auto const metropolis = [&](Flip_plan const& plan) {
+                return replica.accept(plan, coupling, action);
+              };
+              for (std::size_t sweep = 0; sweep < sweeps; ++sweep)
+              {
+                accumulate_report(
+                    report.replicas[i],
+                    replica.engine.run(sweep_options, metropolis));
+              }
+              actions[i] = action(replica.engine.stars()->sums());
+            }
+          },
+          m_partitioner);
+      done += sweeps;
+      if (options.exchange_interval == 0 || m_replicas.size() < 2)
+      {
+        continue;
+      }
+      exchange(actions, report);
+    }
+
+    report.elapsed = Clock::now() - start;
+    return report;
+  }
+
+ private:
+  /// @brief Attempt exchanges between the even or the odd pairs of
+  /// neighboring couplings
+  void exchange(std::vector<double> const& actions, Replica_report& report)
+  {
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (auto i = m_exchange_rounds++ % 2; i + 1 < m_couplings.size(); i += 2)
+    {
+      auto const first  = m_replica_at[i];
+      auto const second = m_replica_at[i + 1];
+      auto const exponent = (m_couplings[i] - m_couplings[i + 1]) *
+                            (actions[first] - actions[second]);
+      ++report.exchanges_attempted;
+      if (exponent < 0.0 && unit(m_generator) >= std::exp(exponent))
+      {
+        continue;
+      }
+      std::swap(m_replica_at[i], m_replica_at[i + 1]);
+      m_replicas[first]->parameter  = i + 1;
+      m_replicas[second]->parameter = i;
+      ++report.exchanges_accepted;
+    }
+  }
+
+  std::vector<double>                   m_couplings;
+  std::vector<std::unique_ptr<Replica>> m_replicas;
+  /// The replica at each coupling
+  std::vector<std::size_t>              m_replica_at;
+  std::mt19937_64                       m_generator;
+  tbb::affinity_partitioner             m_partitioner;
+  std::size_t                           m_exchange_rounds{};
+};
+
+#endif  // BISTELLAR_FLIP_REPLICA_RUNNER_HPP
@@ -0,0 +1,461 @@
+/// @file soa_snapshot.hpp
+/// @brief Export a triangulation to flat arrays for analysis kernels
+/// @author Adam Getchell
+/// @details Observables such as vertex degrees and edge valences are
+/// measured after every sweep. Measuring them on the triangulation chases
+/// handles through the Compact_container for every cell and vertex. An
+/// Soa_snapshot copies the triangulation once into a structure of arrays:
+/// vertex coordinates, and the vertex and neighbor indices of each cell
+/// stored as 4 separate columns. The kernels below are plain loops over
+/// those contiguous arrays, branch-free where possible, so the compiler can
+/// vectorize them.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_SOA_SNAPSHOT_HPP
+#define BISTELLAR_FLIP_SOA_SNAPSHOT_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numbers>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+
+/// @brief A triangulation as a structure of arrays
+/// @details Vertices and cells are numbered as in a snapshot file: vertex 0
+/// is the infinite vertex, the finite vertices follow in container order,
+/// and every cell, finite or infinite, is numbered in container order.
+struct Soa_snapshot
+{
+  /// Coordinates of each vertex; those of the infinite vertex are 0
+  std::vector<double>                       x;
+  std::vector<double>                       y;
+  std::vector<double>                       z;
+  /// Vertex i of cell c is cell_vertices[i][c]
+  std::array<std::vector<std::uint32_t>, 4> cell_vertices;
+  /// Neighbor i of cell c, opposite vertex i, is cell_neighbors[i][c]
+  std::array<std::vector<std::uint32_t>, 4> cell_neighbors;
+
+  /// @return The number of vertices, including the infinite vertex
+  [[nodiscard]] auto number_of_vertices() const noexcept -> std::size_t
+  {
+    return x.size();
+  }
+
+  /// @return The number of cells, including the infinite cells
+  [[nodiscard]] auto number_of_cells() const noexcept -> std::size_t
+  {
+    return cell_vertices[0].size();
+  }
+};
+
+/// @brief Numbers objects by their addresses, in a reusable sorted array
+/// @details Ids are found by binary search. Unlike a hash map, the array
+/// keeps its capacity when cleared, so renumbering as many objects as
+/// before allocates nothing.
+class Address_numbering
+{
+ public:
+  /// @brief Forget every id, keeping the capacity
+  void clear() noexcept { m_entries.clear(); }
+
+  /// @brief Give an object the next id, from 0
+  /// @details Call sort() after the last object and before looking ids up.
+  void push_back(void const* address)
+  {
+    m_entries.emplace_back(address,
+                           static_cast<std::uint32_t>(m_entries.size()));
+  }
+
+  /// @brief Sort the objects by address so their ids can be looked up
+  void sort()
+  {
+    std::sort(m_entries.begin(), m_entries.end(),
+              [](auto const& first, auto const& second) {
+                return std::less<>{}(first.first, second.first);
+              });
+  }
+
+  /// @param address The address of an object given an id
+  /// @return The id of the object
+  [[nodiscard]] auto operator[](void const* address) const -> std::uint32_t
+  {
+    auto const entry = std::lower_bound(
+        m_entries.begin(), m_entries.end(), address,
+        [](auto const& element, void const* value) {
+          return std::less<>{}(element.first, value);
+        });
+    return entry->second;
+  }
+
+ private:
+  std::vector<std::pair<void const*, std::uint32_t>> m_entries;
+};
+
+/// @brief Scratch space for numbering the vertices and cells of a
+/// triangulation while filling a snapshot
+struct Soa_numbering
+{
+  Address_numbering vertices;
+  Address_numbering cells;
+};
+
+/// @brief Copy a triangulation into an existing structure of arrays
+/// @details Reuses the capacity of the arrays and of the numbering, so
+/// refilling a snapshot of a triangulation that has only been flipped
+/// allocates nothing.
+/// @param triangulation A 3-dimensional triangulation
+/// @param snapshot The snapshot to overwrite
+/// @param numbering Scratch space, overwritten
+template <typename Triangulation>
+void fill_soa_snapshot(Triangulation const& triangulation,
+                       Soa_snapshot& snapshot, Soa_numbering& numbering)
+{
+  auto const& tds          = triangulation.tds();
+  auto const  vertex_count = tds.number_of_vertices();
+  auto const  cell_count   = tds.number_of_cells();
+  snapshot.x.clear();
+  snapshot.y.clear();
+  snapshot.z.clear();
+  snapshot.x.reserve(vertex_count);
+  snapshot.y.reserve(vertex_count);
+  snapshot.z.reserve(vertex_count);
+  for (std::size_t i = 0; i < 4; ++i)
+  {
+    snapshot.cell_vertices[i].resize(cell_count);
+    snapshot.cell_neighbors[i].resize(cell_count);
+  }
+
+  auto& vertex_index = numbering.vertices;
+  vertex_index.clear();
+  vertex_index.push_back(&*triangulation.infinite_vertex());
+  snapshot.x.push_back(0.0);
+  snapshot.y.push_back(0.0);
+  snapshot.z.push_back(0.0);
+  for (auto const& vertex : finite_vertices_view(triangulation))
+  {
+    vertex_index.push_back(&*vertex);
+    snapshot.x.push_back(vertex->point().x());
+    snapshot.y.push_back(vertex->point().y());
+    snapshot.z.push_back(vertex->point().z());
+  }
+  vertex_index.sort();
+
+  auto& cell_index = numbering.cells;
+  cell_index.clear();
+  for (auto cell = tds.cells_begin(); cell != tds.cells_end(); ++cell)
+  {
+    cell_index.push_back(&*cell);
+  }
+  cell_index.sort();
+
+  // Cells are numbered in container order, so c counts them
+  std::size_t c = 0;
+  for (auto cell = tds.cells_begin(); cell != tds.cells_end(); ++cell, ++c)
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const column = static_cast<std::size_t>(i);
+      snapshot.cell_vertices[column][c]  = vertex_index[&*cell->vertex(i)];
+      snapshot.cell_neighbors[column][c] = cell_index[&*cell->neighbor(i)];
+    }
+  }
+}  // fill_soa_snapshot()
+
+/// @brief Copy a triangulation into an existing structure of arrays
+/// @details Reuses the capacity of the arrays, but numbers the vertices
+/// and cells in new scratch space.
+/// @param triangulation A 3-dimensional triangulation
+/// @param snapshot The snapshot to overwrite
+template <typename Triangulation>
+void fill_soa_snapshot(Triangulation const& triangulation,
+                       Soa_snapshot&        snapshot)
+{
+  Soa_numbering numbering;
+  fill_soa_snapshot(triangulation, snapshot, numbering);
+}  // fill_soa_snapshot()
+
+/// @brief Copy a triangulation into a structure of arrays
+/// @param triangulation A 3-dimensional triangulation
+/// @return The snapshot
+template <typename Triangulation>
+[[nodiscard]] auto make_soa_snapshot(Triangulation const& triangulation)
+    -> Soa_snapshot
+{
+  Soa_snapshot snapshot;
+  fill_soa_snapshot(triangulation, snapshot);
+  return snapshot;
+}  // make_soa_snapshot()
+
+/// @brief Views of the 4 columns of a snapshot
+/// @details The kernels loop over spans held in locals rather than over
+/// the vectors, whose sizes and data pointers the compiler must otherwise
+/// reload after every store it cannot prove does not alias them.
+[[nodiscard]] inline auto columns(
+    std::array<std::vector<std::uint32_t>, 4> const& arrays)
+    -> std::array<std::span<std::uint32_t const>, 4>
+{
+  return {arrays[0], arrays[1], arrays[2], arrays[3]};
+}  // columns()
+
+/// @return 1 for each finite cell and 0 for each infinite cell
+[[nodiscard]] inline auto finite_cell_mask(Soa_snapshot const& snapshot)
+    -> std::vector<std::uint8_t>
+{
+  auto const [v0, v1, v2, v3] = columns(snapshot.cell_vertices);
+  std::vector<std::uint8_t> mask(snapshot.number_of_cells());
+  std::span const           out{mask};
+  for (std::size_t c = 0; c < out.size(); ++c)
+  {
+    out[c] = static_cast<std::uint8_t>((v0[c] != 0) & (v1[c] != 0) &
+                                       (v2[c] != 0) & (v3[c] != 0));
+  }
+  return mask;
+}  // finite_cell_mask()
+
+/// @brief Count the cells, finite or infinite, incident to each vertex
+[[nodiscard]] inline auto incident_cell_counts(Soa_snapshot const& snapshot)
+    -> std::vector<std::uint32_t>
+{
+  std::vector<std::uint32_t> counts(snapshot.number_of_vertices());
+  for (auto const& column : snapshot.cell_vertices)
+  {
+    for (auto const vertex : column) { ++counts[vertex]; }
+  }
+  return counts;
+}  // incident_cell_counts()
+
+/// @brief The degree of each vertex, as Triangulation::degree() counts it
+/// @details The star of every vertex, including the infinite vertex, is a
+/// ball whose boundary is a triangulated 2-sphere with one triangle per
+/// incident cell. By Euler's formula the sphere has 2 + cells / 2 vertices,
+/// which are the neighbors of the vertex, so no edges need be enumerated.
+/// @return The number of vertices adjacent to each vertex, counting the
+/// infinite vertex for vertices on the convex hull
+[[nodiscard]] inline auto vertex_degrees(Soa_snapshot const& snapshot)
+    -> std::vector<std::uint32_t>
+{
+  auto degrees = incident_cell_counts(snapshot);
+  for (auto& degree : degrees) { degree = 2 + degree / 2; }
+  return degrees;
+}  // vertex_degrees()
+
+/// @return Both endpoints of an edge as one sortable key, smaller first
+[[nodiscard]] inline auto edge_key(std::uint32_t first,
+                                   std::uint32_t second) -> std::uint64_t
+{
+  auto const low  = std::min(first, second);
+  auto const high = std::max(first, second);
+  return (static_cast<std::uint64_t>(low) << 32) | high;
+}  // edge_key()
+
+/// The 6 edges of a cell, as pairs of vertex indices
+inline constexpr std::array<std::array<std::size_t, 2>, 6> CELL_EDGES{
+    {{0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {2, 3}}
+};
+
+/// @return The sorted keys of the edges of the cells with the given mask
+/// value, with one key per cell containing the edge
+[[nodiscard]] inline auto edge_keys(Soa_snapshot const&              snapshot,
+                                    std::vector<std::uint8_t> const& mask,
+                                    std::uint8_t                     finite)
+    -> std::vector<std::uint64_t>
+{
+  auto const                 cells = static_cast<std::size_t>(
+      std::count(mask.begin(), mask.end(), finite));
+  std::vector<std::uint64_t> keys;
+  keys.reserve(6 * cells);
+  for (std::size_t c = 0; c < mask.size(); ++c)
+  {
+    if (mask[c] != finite) { continue; }
+    for (auto const& [i, j] : CELL_EDGES)
+    {
+      auto const first  = snapshot.cell_vertices[i][c];
+      auto const second = snapshot.cell_vertices[j][c];
+      if (first != 0 && second != 0)
+      {
+        keys.push_back(edge_key(first, second));
+      }
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+  return keys;
+}  // edge_keys()
+
+/// @brief The finite edges and their valences
+struct Edge_valences
+{
+  /// Keys of the finite edges, in increasing order: the smaller vertex
+  /// index in the high 32 bits and the larger in the low 32 bits
+  std::vector<std::uint64_t> edges;
+  /// The number of finite cells incident to each edge
+  std::vector<std::uint32_t> valences;
+  /// Whether each edge is on the convex hull
+  std::vector<std::uint8_t>  on_hull;
+};
+
+/// @brief Find the valence of every finite edge
+/// @details The edges of each finite cell are sorted, so each edge appears
+/// once per incident finite cell. Edges of infinite cells are on the hull.
+/// The valences match count_finite_incident_cells(); pivot edges have
+/// valence 4 and are not on the hull.
+[[nodiscard]] inline auto edge_valences(Soa_snapshot const& snapshot)
+    -> Edge_valences
+{
+  auto const mask = finite_cell_mask(snapshot);
+  auto const keys = edge_keys(snapshot, mask, 1);
+  auto hull_keys  = edge_keys(snapshot, mask, 0);
+  hull_keys.erase(std::unique(hull_keys.begin(), hull_keys.end()),
+                  hull_keys.end());
+
+  Edge_valences result;
+  for (std::size_t first = 0; first < keys.size();)
+  {
+    auto last = first + 1;
+    while (last < keys.size() && keys[last] == keys[first]) { ++last; }
+    result.edges.push_back(keys[first]);
+    result.valences.push_back(static_cast<std::uint32_t>(last - first));
+    result.on_hull.push_back(static_cast<std::uint8_t>(std::binary_search(
+        hull_keys.begin(), hull_keys.end(), keys[first])));
+    first = last;
+  }
+  return result;
+}  // edge_valences()
+
+/// @brief Six times the signed volume of each cell
+/// @details Positive for positively oriented cells, as CGAL::orientation()
+/// would report them, and 0 for infinite cells. Inexact: use
+/// CGAL::orientation() where the sign of a nearly flat cell matters.
+/// Coordinates are gathered a block of cells at a time into local arrays,
+/// which cannot alias the output, so both loops vectorize.
+[[nodiscard]] inline auto signed_volumes(Soa_snapshot const& snapshot)
+    -> std::vector<double>
+{
+  static constexpr std::size_t BLOCK = 64;
+  using Block                        = std::array<double, BLOCK>;
+
+  auto const vertices = columns(snapshot.cell_vertices);
+  std::array<std::span<double const>, 3> const coordinates{
+      std::span{snapshot.x}, std::span{snapshot.y}, std::span{snapshot.z}};
+  std::vector<double> volumes(snapshot.number_of_cells());
+  std::span const     out{volumes};
+
+  // Edge vectors from vertex 0 to vertices 1, 2 and 3 of each cell
+  std::array<std::array<Block, 3>, 3> edges{};
+  Block                               finite{};
+  for (std::size_t first = 0; first < out.size(); first += BLOCK)
+  {
+    auto const count = std::min(BLOCK, out.size() - first);
+    for (std::size_t k = 0; k < count; ++k)
+    {
+      finite[k] = static_cast<double>(
+          (vertices[0][first + k] != 0) & (vertices[1][first + k] != 0) &
+          (vertices[2][first + k] != 0) & (vertices[3][first + k] != 0));
+    }
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      for (std::size_t axis = 0; axis < 3; ++axis)
+      {
+        auto const& coordinate = coordinates[axis];
+        for (std::size_t k = 0; k < count; ++k)
+        {
+          edges[i][axis][k] = coordinate[vertices[i + 1][first + k]] -
+                              coordinate[vertices[0][first + k]];
+        }
+      }
+    }
+    auto const& [a, b, c] = edges;
+    for (std::size_t k = 0; k < count; ++k)
+    {
+      out[first + k] =
+          finite[k] *
+          (a[0][k] * (b[1][k] * c[2][k] - b[2][k] * c[1][k]) -
+           a[1][k] * (b[0][k] * c[2][k] - b[2][k] * c[0][k]) +
+           a[2][k] * (b[0][k] * c[1][k] - b[1][k] * c[0][k]));
+    }
+  }
+  return volumes;
+}  // signed_volumes()
+
+/// @return How many of the values are equal to each index
+[[nodiscard]] inline auto histogram(std::vector<std::uint32_t> const& values)
+    -> std::vector<std::size_t>
+{
+  std::vector<std::size_t> counts;
+  if (values.empty()) { return counts; }
+  auto const largest = *std::max_element(values.begin(), values.end());
+  counts.resize(std::size_t{largest} + 1);
+  for (auto const value : values) { ++counts[value]; }
+  return counts;
+}  // histogram()
+
+/// @brief The statistics logged after each sweep
+struct Sweep_statistics
+{
+  /// The number of finite vertices of each degree
+  std::vector<std::size_t> degree_histogram;
+  /// The number of finite edges of each valence
+  std::vector<std::size_t> valence_histogram;
+  double                   mean_degree{};
+  double                   mean_valence{};
+  /// The total deficit angle of the interior edges, were every cell
+  /// equilateral: the sum of 2π minus valence times the dihedral angle
+  /// arccos(1/3). A combinatorial proxy for the total curvature.
+  double                   total_deficit_angle{};
+  /// Finite cells that are not positively oriented
+  std::size_t              inverted_cells{};
+};
+
+/// @brief Compute the sweep statistics of a snapshot
+[[nodiscard]] inline auto sweep_statistics(Soa_snapshot const& snapshot)
+    -> Sweep_statistics
+{
+  Sweep_statistics statistics;
+
+  auto degrees = vertex_degrees(snapshot);
+  if (!degrees.empty()) { degrees.erase(degrees.begin()); }
+  statistics.degree_histogram = histogram(degrees);
+  if (!degrees.empty())
+  {
+    std::uint64_t total = 0;
+    for (auto const degree : degrees) { total += degree; }
+    statistics.mean_degree =
+        static_cast<double>(total) / static_cast<double>(degrees.size());
+  }
+
+  auto const valences           = edge_valences(snapshot);
+  statistics.valence_histogram  = histogram(valences.valences);
+  auto const    dihedral_angle = std::acos(1.0 / 3.0);
+  std::uint64_t total          = 0;
+  for (std::size_t e = 0; e < valences.valences.size(); ++e)
+  {
+    auto const valence = valences.valences[e];
+    total += valence;
+    auto const interior = static_cast<double>(valences.on_hull[e] == 0);
+    statistics.total_deficit_angle +=
+        interior * (2.0 * std::numbers::pi -
+                    static_cast<double>(valence) * dihedral_angle);
+  }
+  if (!valences.valences.empty())
+  {
+    statistics.mean_valence = static_cast<double>(total) /
+                              static_cast<double>(valences.valences.size());
+  }
+
+  auto const volumes = signed_volumes(snapshot);
+  auto const mask    = finite_cell_mask(snapshot);
+  for (std::size_t c = 0; c < volumes.size(); ++c)
+  {
+    statistics.inverted_cells +=
+        static_cast<std::size_t>(mask[c] & (volumes[c] <= 0.0));
+  }
+  return statistics;
+}  // sweep_statistics()
+
+#endif  // BISTELLAR_FLIP_SOA_SNAPSHOT_HPP
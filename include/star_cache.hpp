@@ -0,0 +1,280 @@
+/// @file star_cache.hpp
+/// @brief Keep vertex degrees and edge valences up to date across flips
+/// @author Adam Getchell
+/// @details An action of vertex degrees and edge valences must be evaluated
+/// after every move. Counting them walks the star of each vertex or edge,
+/// as gathering incident cells for flip_n_to_m does. A bistellar flip only
+/// changes the stars of its 6 vertices, by amounts fixed by the move, so a
+/// Star_cache counts every star once and then applies those amounts to the
+/// 6 vertices and 10 edges of each flip, together with running sums of
+/// squared degrees and valences. The change in the sums can be read off a
+/// plan before the flip is applied.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_STAR_CACHE_HPP
+#define BISTELLAR_FLIP_STAR_CACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "soa_snapshot.hpp"
+
+/// @brief Running sums over the finite vertices and edges, or changes in
+/// them
+struct Star_sums
+{
+  /// The sum of the squared degrees of the finite vertices
+  std::int64_t degree_squares{};
+  /// The sum of the squared valences of the finite edges
+  std::int64_t valence_squares{};
+
+  auto operator==(Star_sums const&) const -> bool = default;
+
+  /// @return The sums after a change, e.g. from Star_cache::delta()
+  [[nodiscard]] auto operator+(Star_sums const& change) const -> Star_sums
+  {
+    return {degree_squares + change.degree_squares,
+            valence_squares + change.valence_squares};
+  }
+};
+
+/// @brief Incident-cell counts, degrees and edge valences, updated by each
+/// flip in O(1)
+/// @details The cache numbers the vertices itself, so their info, if any,
+/// is left alone. Only bistellar flips are tracked. After any other move,
+/// or after relayout(), build a new cache.
+/// @tparam Triangulation A 3-dimensional CGAL triangulation
+template <typename Triangulation>
+class Star_cache
+{
+ public:
+  using Vertex_handle = Vertex_handle_t<Triangulation>;
+  using Plan          = Basic_flip_plan<Triangulation>;
+
+  /// @brief Number the vertices and count their stars
+  /// @details The finite vertices are numbered 0 ... n - 1 in container
+  /// order and the infinite vertex n. Every cell is visited once.
+  /// @param triangulation A 3-dimensional triangulation
+  explicit Star_cache(Triangulation const& triangulation)
+      : m_infinite{static_cast<std::uint32_t>(
+            triangulation.number_of_vertices())}
+      , m_cells(std::size_t{m_infinite} + 1)
+  {
+    m_ids.reserve(m_cells.size());
+    std::uint32_t id = 0;
+    for (auto const& vertex : finite_vertices_view(triangulation))
+    {
+      m_ids.emplace(vertex, id++);
+    }
+    m_ids.emplace(triangulation.infinite_vertex(), m_infinite);
+
+    // The star of the infinite vertex closes the triangulation into a
+    // 3-sphere, so by Euler's formula there are vertices + cells edges
+    auto const& tds = triangulation.tds();
+    m_valences.reserve(m_cells.size() + tds.number_of_cells());
+    for (auto cell = tds.cells_begin(); cell != tds.cells_end(); ++cell)
+    {
+      std::array<std::uint32_t, 4> ids{};
+      for (int i = 0; i < 4; ++i)
+      {
+        ids[static_cast<std::size_t>(i)] = id_of(cell->vertex(i));
+      }
+      for (auto const vertex : ids) { ++m_cells[vertex]; }
+      for (auto const& [i, j] : CELL_EDGES)
+      {
+        ++m_valences[edge_key(ids[i], ids[j])];
+      }
+    }
+
+    for (std::uint32_t vertex = 0; vertex < m_infinite; ++vertex)
+    {
+      m_sums.degree_squares += square(degree_of(m_cells[vertex]));
+    }
+    for (auto const& [key, valence] : m_valences)
+    {
+      if (is_finite_edge(key)) { m_sums.valence_squares += square(valence); }
+    }
+  }
+
+  /// @return The id the cache gave a vertex
+  [[nodiscard]] auto id_of(Vertex_handle const& vertex) const -> std::uint32_t
+  {
+    return m_ids.find(vertex)->second;
+  }
+
+  /// @return The number of cells, finite or infinite, incident to a vertex
+  [[nodiscard]] auto incident_cells(Vertex_handle const& vertex) const
+      -> std::uint32_t
+  {
+    return m_cells[id_of(vertex)];
+  }
+
+  /// @return The degree of a vertex, as Triangulation::degree() counts it
+  [[nodiscard]] auto degree(Vertex_handle const& vertex) const
+      -> std::uint32_t
+  {
+    return degree_of(m_cells[id_of(vertex)]);
+  }
+
+  /// @return The number of cells incident to the edge between two
+  /// vertices, or 0 if they are not joined by an edge
+  [[nodiscard]] auto valence(Vertex_handle const& first,
+                             Vertex_handle const& second) const
+      -> std::uint32_t
+  {
+    auto const entry = m_valences.find(edge_key(id_of(first), id_of(second)));
+    return entry == m_valences.end() ? 0 : entry->second;
+  }
+
+  /// @return The number of edges, finite or infinite
+  [[nodiscard]] auto number_of_edges() const noexcept -> std::size_t
+  {
+    return m_valences.size();
+  }
+
+  /// @return The running sums over the finite vertices and edges
+  [[nodiscard]] auto sums() const noexcept -> Star_sums const&
+  {
+    return m_sums;
+  }
+
+  /// @brief The change in the running sums if a flip were applied
+  /// @param plan A successful plan whose flip has not been applied
+  /// @return The change in each sum
+  [[nodiscard]] auto delta(Plan const& plan) const -> Star_sums
+  {
+    return change(plan, 1);
+  }
+
+  /// @brief Account for a flip that was applied
+  /// @param plan The plan of the flip
+  void update(Plan const& plan) { apply(plan, 1); }
+
+  /// @brief Account for a flip that was undone, e.g. by Flip_journal
+  /// @param plan The plan of the undone flip
+  void revert(Plan const& plan) { apply(plan, -1); }
+
+ private:
+  /// Cells gained by each vertex in Basic_flip_plan::vertices(): top,
+  /// bottom, pivot_from_1, pivot_from_2, pivot_to_1, pivot_to_2
+  static constexpr std::array<int, 6> CELL_CHANGES{0, 0, -2, -2, 2, 2};
+
+  /// Cells gained by an edge between two of those vertices
+  struct Edge_change
+  {
+    std::size_t first;
+    std::size_t second;
+    int         cells;
+  };
+
+  /// The old pivot edge loses its 4 cells and the new one gains 4. Top
+  /// and bottom share 1 cell with each pivot_from vertex instead of 2, and
+  /// 2 with each pivot_to vertex instead of 1. No other edge changes.
+  static constexpr std::array<Edge_change, 10> EDGE_CHANGES{
+      {{2, 3, -4},
+       {4, 5, 4},
+       {0, 2, -1},
+       {0, 3, -1},
+       {1, 2, -1},
+       {1, 3, -1},
+       {0, 4, 1},
+       {0, 5, 1},
+       {1, 4, 1},
+       {1, 5, 1}}
+  };
+
+  [[nodiscard]] static auto degree_of(std::uint32_t cells) -> std::uint32_t
+  {
+    // The link of a vertex is a triangulated 2-sphere, see vertex_degrees()
+    return 2 + cells / 2;
+  }
+
+  [[nodiscard]] static auto square(std::uint32_t value) -> std::int64_t
+  {
+    return std::int64_t{value} * std::int64_t{value};
+  }
+
+  [[nodiscard]] auto is_finite_edge(std::uint64_t key) const -> bool
+  {
+    // The infinite vertex has the largest id, so is the second endpoint
+    return (key & 0xFFFF'FFFFU) != m_infinite;
+  }
+
+  [[nodiscard]] auto ids_of(Plan const& plan) const
+      -> std::array<std::uint32_t, 6>
+  {
+    auto const                   vertices = plan.vertices();
+    std::array<std::uint32_t, 6> ids{};
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      ids[i] = id_of(vertices[i]);
+    }
+    return ids;
+  }
+
+  /// @return The change in the sums from adding sign times each change
+  [[nodiscard]] auto change(Plan const& plan, int sign) const -> Star_sums
+  {
+    auto const ids = ids_of(plan);
+    Star_sums  result;
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      if (CELL_CHANGES[i] == 0 || ids[i] == m_infinite) { continue; }
+      auto const cells = m_cells[ids[i]];
+      auto const after =
+          static_cast<std::uint32_t>(static_cast<int>(cells) +
+                                     sign * CELL_CHANGES[i]);
+      result.degree_squares +=
+          square(degree_of(after)) - square(degree_of(cells));
+    }
+    for (auto const& [first, second, cells] : EDGE_CHANGES)
+    {
+      auto const key = edge_key(ids[first], ids[second]);
+      if (!is_finite_edge(key)) { continue; }
+      auto const entry   = m_valences.find(key);
+      auto const valence = entry == m_valences.end() ? 0U : entry->second;
+      auto const after   = static_cast<std::uint32_t>(
+          static_cast<int>(valence) + sign * cells);
+      result.valence_squares += square(after) - square(valence);
+    }
+    return result;
+  }
+
+  void apply(Plan const& plan, int sign)
+  {
+    auto const difference = change(plan, sign);
+    m_sums.degree_squares += difference.degree_squares;
+    m_sums.valence_squares += difference.valence_squares;
+
+    auto const ids = ids_of(plan);
+    for (std::size_t i = 0; i < ids.size(); ++i)
+    {
+      m_cells[ids[i]] = static_cast<std::uint32_t>(
+          static_cast<int>(m_cells[ids[i]]) + sign * CELL_CHANGES[i]);
+    }
+    for (auto const& [first, second, cells] : EDGE_CHANGES)
+    {
+      auto const key     = edge_key(ids[first], ids[second]);
+      auto&      valence = m_valences[key];
+      valence =
+          static_cast<std::uint32_t>(static_cast<int>(valence) + sign * cells);
+      if (valence == 0) { m_valences.erase(key); }
+    }
+  }
+
+  /// The id of the infinite vertex, one more than the largest finite id
+  std::uint32_t                                    m_infinite;
+  /// The id of each vertex; flips create and delete no vertex
+  std::unordered_map<Vertex_handle, std::uint32_t> m_ids;
+  /// The number of cells incident to each vertex, by id
+  std::vector<std::uint32_t>                       m_cells;
+  /// The number of cells incident to each edge, by edge_key() of its ids
+  std::unordered_map<std::uint64_t, std::uint32_t> m_valences;
+  Star_sums                                        m_sums;
+};
+
+#endif  // BISTELLAR_FLIP_STAR_CACHE_HPP
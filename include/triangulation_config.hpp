@@ -0,0 +1,101 @@
+/// @file triangulation_config.hpp
+/// @brief Compile-time choice of kernel and per-simplex info
+/// @author Adam Getchell
+/// @details The flip functions are templates over the triangulation type, so
+/// the data stored in each vertex and cell is chosen here rather than fixed.
+/// An info type of void selects CGAL's plain vertex or cell base, which
+/// stores no info at all. For very large runs this keeps each cell down to
+/// its 4 vertex and 4 neighbor handles.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_TRIANGULATION_CONFIG_HPP
+#define BISTELLAR_FLIP_TRIANGULATION_CONFIG_HPP
+
+#include <CGAL/Delaunay_triangulation_3.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Triangulation_cell_base_3.h>
+#include <CGAL/Triangulation_cell_base_with_info_3.h>
+#include <CGAL/Triangulation_data_structure_3.h>
+#include <CGAL/Triangulation_vertex_base_3.h>
+#include <CGAL/Triangulation_vertex_base_with_info_3.h>
+
+#include <cstdint>
+#include <variant>
+
+using K = CGAL::Exact_predicates_inexact_constructions_kernel;
+
+/// @brief The vertex base storing an info of type Info
+template <typename Kernel, typename Info>
+struct Vertex_base_for
+{
+  using type = CGAL::Triangulation_vertex_base_with_info_3<Info, Kernel>;
+};
+
+/// @brief The vertex base storing no info
+template <typename Kernel>
+struct Vertex_base_for<Kernel, void>
+{
+  using type = CGAL::Triangulation_vertex_base_3<Kernel>;
+};
+
+/// @brief The cell base storing an info of type Info
+template <typename Kernel, typename Info>
+struct Cell_base_for
+{
+  using type = CGAL::Triangulation_cell_base_with_info_3<Info, Kernel>;
+};
+
+/// @brief The cell base storing no info
+template <typename Kernel>
+struct Cell_base_for<Kernel, void>
+{
+  using type = CGAL::Triangulation_cell_base_3<Kernel>;
+};
+
+/// @brief A sequential Delaunay triangulation with the given per-simplex info
+/// @tparam Kernel The geometric kernel
+/// @tparam Vertex_info The info stored in each vertex, or void for none
+/// @tparam Cell_info The info stored in each cell, or void for none
+template <typename Kernel, typename Vertex_info, typename Cell_info>
+using Delaunay_triangulation = CGAL::Delaunay_triangulation_3<
+    Kernel, CGAL::Triangulation_data_structure_3<
+                typename Vertex_base_for<Kernel, Vertex_info>::type,
+                typename Cell_base_for<Kernel, Cell_info>::type,
+                CGAL::Sequential_tag>>;
+
+/// The default configuration: an int in each vertex and cell
+using Vb  = Vertex_base_for<K, int>::type;
+using Cb  = Cell_base_for<K, int>::type;
+using Tds = CGAL::Triangulation_data_structure_3<Vb, Cb, CGAL::Sequential_tag>;
+using Delaunay = CGAL::Delaunay_triangulation_3<K, Tds>;
+
+/// 32-bit vertex ids and no cell info, for memory-lean runs
+using Compact_delaunay = Delaunay_triangulation<K, std::uint32_t, void>;
+
+/// 32-bit vertex and cell ids
+using Indexed_delaunay =
+    Delaunay_triangulation<K, std::uint32_t, std::uint32_t>;
+
+/// 32-bit vertex ids and a caller-defined payload in each cell
+template <typename Payload>
+using Delaunay_with_cell_payload =
+    Delaunay_triangulation<K, std::uint32_t, Payload>;
+
+/// Whether a vertex or cell type stores an info
+template <typename Simplex>
+concept Has_info = requires(Simplex& simplex) { simplex.info(); };
+
+/// The information stored in a vertex or cell, or std::monostate if none
+template <typename Simplex>
+struct Info_of
+{
+  using type = std::monostate;
+};
+
+template <Has_info Simplex>
+struct Info_of<Simplex>
+{
+  using type = typename Simplex::Info;
+};
+
+#endif  // BISTELLAR_FLIP_TRIANGULATION_CONFIG_HPP
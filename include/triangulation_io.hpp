@@ -0,0 +1,502 @@
+/// @file triangulation_io.hpp
+/// @brief Save and load triangulations as binary snapshots
+/// @author Adam Getchell
+/// @details Flipped triangulations are not Delaunay, so they cannot be
+/// rebuilt from their points. A snapshot stores the combinatorics as well,
+/// in flat arrays after a fixed header:
+/// - the points of the finite vertices, 3 doubles each
+/// - the info of the finite vertices, if the vertices have info
+/// - the 4 vertex indices of each cell
+/// - the 4 neighbor indices of each cell
+/// - the info of each cell, if the cells have info
+///
+/// Indices are 32-bit, and vertex 0 is the infinite vertex. Values are in
+/// the byte order of the machine that wrote them, which the header records.
+/// Loading maps the file into memory and builds the triangulation data
+/// structure in one linear pass, without re-triangulating.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_TRIANGULATION_IO_HPP
+#define BISTELLAR_FLIP_TRIANGULATION_IO_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "bistellar_flip.hpp"
+#include "triangulation_config.hpp"
+
+/// @brief The reasons saving or loading a snapshot can fail
+enum class Snapshot_status
+{
+  SUCCESS,
+  CANNOT_OPEN,
+  WRITE_FAILED,
+  WRONG_DIMENSION,
+  TOO_LARGE,
+  BAD_HEADER,
+  WRONG_SIZE,
+  CORRUPT
+};
+
+/// @return A human-readable name for a snapshot status
+[[nodiscard]] inline auto to_string(Snapshot_status status) -> std::string
+{
+  switch (status)
+  {
+    case Snapshot_status::SUCCESS: return "success";
+    case Snapshot_status::CANNOT_OPEN: return "cannot open";
+    case Snapshot_status::WRITE_FAILED: return "write failed";
+    case Snapshot_status::WRONG_DIMENSION: return "wrong dimension";
+    case Snapshot_status::TOO_LARGE: return "too large";
+    case Snapshot_status::BAD_HEADER: return "bad header";
+    case Snapshot_status::WRONG_SIZE: return "wrong size";
+    case Snapshot_status::CORRUPT: return "corrupt";
+  }
+  return "unknown";
+}  // to_string()
+
+/// @brief The fixed-size start of a snapshot
+struct Snapshot_header
+{
+  static constexpr std::array<char, 8> MAGIC{'B', 'S', 'T', 'F',
+                                             'L', 'I', 'P', '\0'};
+  static constexpr std::uint32_t       VERSION     = 1;
+  /// Reads back differently on a machine of the other byte order
+  static constexpr std::uint32_t       ENDIAN_MARK = 0x01020304;
+
+  std::array<char, 8> magic{MAGIC};
+  std::uint32_t       version{VERSION};
+  std::uint32_t       byte_order{ENDIAN_MARK};
+  /// All vertices, including the infinite vertex
+  std::uint64_t       number_of_vertices{};
+  /// All cells, including the infinite cells
+  std::uint64_t       number_of_cells{};
+  std::uint32_t       vertex_info_size{};
+  std::uint32_t       cell_info_size{};
+
+  /// @return The size in bytes of a snapshot with this header
+  [[nodiscard]] auto file_size() const -> std::uint64_t
+  {
+    auto const finite_vertices = number_of_vertices - 1;
+    return sizeof(Snapshot_header) +
+           finite_vertices * (3 * sizeof(double) + vertex_info_size) +
+           number_of_cells * (8 * sizeof(std::uint32_t) + cell_info_size);
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<Snapshot_header>);
+static_assert(sizeof(Snapshot_header) == 40);
+
+/// @return The number of bytes of info a snapshot stores per vertex or cell
+template <typename Simplex>
+[[nodiscard]] constexpr auto snapshot_info_size() -> std::uint32_t
+{
+  if constexpr (Has_info<Simplex>)
+  {
+    static_assert(std::is_trivially_copyable_v<typename Simplex::Info>,
+                  "Only trivially copyable info can be saved in a snapshot");
+    return sizeof(typename Simplex::Info);
+  }
+  else { return 0; }
+}  // snapshot_info_size()
+
+/// @brief Write a triangulation as a snapshot to a binary stream
+/// @details Vertices and cells are written in the order of their
+/// containers, so a snapshot of a loaded triangulation is identical to the
+/// one it was loaded from.
+/// @param triangulation A 3-dimensional triangulation
+/// @param out A stream opened in binary mode
+/// @return Whether the snapshot was written, or why not
+template <typename Triangulation>
+[[nodiscard]] auto write_snapshot(Triangulation const& triangulation,
+                                  std::ostream&        out) -> Snapshot_status
+{
+  static_assert(
+      std::is_same_v<typename Triangulation::Geom_traits::FT, double>);
+
+  auto const& tds = triangulation.tds();
+  if (tds.dimension() != 3) { return Snapshot_status::WRONG_DIMENSION; }
+  if (tds.number_of_vertices() > std::numeric_limits<std::uint32_t>::max() ||
+      tds.number_of_cells() > std::numeric_limits<std::uint32_t>::max())
+  {
+    return Snapshot_status::TOO_LARGE;
+  }
+
+  Snapshot_header header;
+  header.number_of_vertices = tds.number_of_vertices();
+  header.number_of_cells    = tds.number_of_cells();
+  header.vertex_info_size =
+      snapshot_info_size<typename Triangulation::Vertex>();
+  header.cell_info_size = snapshot_info_size<typename Triangulation::Cell>();
+
+  auto const write = [&out](void const* data, std::size_t size) {
+    out.write(static_cast<char const*>(data),
+              static_cast<std::streamsize>(size));
+  };
+  write(&header, sizeof(header));
+
+  // Number the vertices, infinite vertex first
+  std::unordered_map<Vertex_handle_t<Triangulation>, std::uint32_t>
+      vertex_index;
+  vertex_index.reserve(tds.number_of_vertices());
+  vertex_index.emplace(triangulation.infinite_vertex(), 0);
+  for (auto const& vertex : finite_vertices_view(triangulation))
+  {
+    vertex_index.emplace(vertex,
+                         static_cast<std::uint32_t>(vertex_index.size()));
+    auto const& point = vertex->point();
+    std::array<double, 3> const coordinates{point.x(), point.y(), point.z()};
+    write(coordinates.data(), sizeof(coordinates));
+  }
+  if constexpr (Has_info<typename Triangulation::Vertex>)
+  {
+    for (auto const& vertex : finite_vertices_view(triangulation))
+    {
+      write(&vertex->info(), sizeof(vertex->info()));
+    }
+  }
+
+  std::unordered_map<Cell_handle_t<Triangulation>, std::uint32_t> cell_index;
+  cell_index.reserve(tds.number_of_cells());
+  for (auto cell = tds.cells_begin(); cell != tds.cells_end(); ++cell)
+  {
+    cell_index.emplace(cell, static_cast<std::uint32_t>(cell_index.size()));
+    std::array<std::uint32_t, 4> indices{};
+    for (int i = 0; i < 4; ++i)
+    {
+      indices[static_cast<std::size_t>(i)] = vertex_index.at(cell->vertex(i));
+    }
+    write(indices.data(), sizeof(indices));
+  }
+  for (auto cell = tds.cells_begin(); cell != tds.cells_end(); ++cell)
+  {
+    std::array<std::uint32_t, 4> indices{};
+    for (int i = 0; i < 4; ++i)
+    {
+      indices[static_cast<std::size_t>(i)] = cell_index.at(cell->neighbor(i));
+    }
+    write(indices.data(), sizeof(indices));
+  }
+  if constexpr (Has_info<typename Triangulation::Cell>)
+  {
+    for (auto cell = tds.cells_begin(); cell != tds.cells_end(); ++cell)
+    {
+      write(&cell->info(), sizeof(cell->info()));
+    }
+  }
+
+  return out ? Snapshot_status::SUCCESS : Snapshot_status::WRITE_FAILED;
+}  // write_snapshot()
+
+/// @brief Save a triangulation as a snapshot file
+/// @param triangulation A 3-dimensional triangulation
+/// @param path The file to write
+/// @return Whether the snapshot was saved, or why not
+template <typename Triangulation>
+[[nodiscard]] auto save_snapshot(Triangulation const&         triangulation,
+                                 std::filesystem::path const& path)
+    -> Snapshot_status
+{
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) { return Snapshot_status::CANNOT_OPEN; }
+  auto const status = write_snapshot(triangulation, out);
+  out.close();
+  if (status == Snapshot_status::SUCCESS && !out)
+  {
+    return Snapshot_status::WRITE_FAILED;
+  }
+  return status;
+}  // save_snapshot()
+
+/// @brief Build a triangulation from a snapshot in memory
+/// @details Any previous contents of the triangulation are discarded. The
+/// cells and vertices are created in snapshot order, so the loaded
+/// triangulation iterates in the same order as the saved one. Indices out
+/// of range, repeated vertices in a cell, and neighbors that are not
+/// mutual or do not share a facet are rejected as corrupt.
+/// @param bytes The whole snapshot
+/// @param triangulation The triangulation to build
+/// @return Whether the triangulation was built, or why not
+template <typename Triangulation>
+[[nodiscard]] auto read_snapshot(std::span<std::byte const> bytes,
+                                 Triangulation& triangulation)
+    -> Snapshot_status
+{
+  using Triangulation_point = typename Triangulation::Point;
+
+  Snapshot_header header;
+  if (bytes.size() < sizeof(header)) { return Snapshot_status::BAD_HEADER; }
+  std::memcpy(&header, bytes.data(), sizeof(header));
+  if (header.magic != Snapshot_header::MAGIC ||
+      header.version != Snapshot_header::VERSION ||
+      header.byte_order != Snapshot_header::ENDIAN_MARK ||
+      header.number_of_vertices == 0 ||
+      header.vertex_info_size !=
+          snapshot_info_size<typename Triangulation::Vertex>() ||
+      header.cell_info_size !=
+          snapshot_info_size<typename Triangulation::Cell>())
+  {
+    return Snapshot_status::BAD_HEADER;
+  }
+  if (header.number_of_vertices > std::numeric_limits<std::uint32_t>::max() ||
+      header.number_of_cells > std::numeric_limits<std::uint32_t>::max())
+  {
+    return Snapshot_status::TOO_LARGE;
+  }
+  if (bytes.size() != header.file_size())
+  {
+    return Snapshot_status::WRONG_SIZE;
+  }
+
+  // The arrays are not necessarily aligned, so values are copied out
+  auto       position = bytes.data() + sizeof(header);
+  auto const read     = [&position](void* data, std::size_t size) {
+    std::memcpy(data, position, size);
+    position += size;
+  };
+  auto const vertex_count = static_cast<std::size_t>(header.number_of_vertices);
+  auto const cell_count   = static_cast<std::size_t>(header.number_of_cells);
+
+  auto& tds = triangulation.tds();
+  tds.clear();
+  tds.vertices().reserve(vertex_count);
+  tds.cells().reserve(cell_count);
+
+  std::vector<Vertex_handle_t<Triangulation>> vertices;
+  vertices.reserve(vertex_count);
+  vertices.emplace_back(tds.create_vertex());
+  for (std::size_t i = 1; i < vertex_count; ++i)
+  {
+    std::array<double, 3> coordinates{};
+    read(coordinates.data(), sizeof(coordinates));
+    auto const vertex = tds.create_vertex();
+    vertex->set_point(
+        Triangulation_point{coordinates[0], coordinates[1], coordinates[2]});
+    vertices.emplace_back(vertex);
+  }
+  if constexpr (Has_info<typename Triangulation::Vertex>)
+  {
+    for (std::size_t i = 1; i < vertex_count; ++i)
+    {
+      read(&vertices[i]->info(), sizeof(vertices[i]->info()));
+    }
+  }
+
+  std::vector<Cell_handle_t<Triangulation>> cells;
+  cells.reserve(cell_count);
+  auto status = Snapshot_status::SUCCESS;
+  for (std::size_t c = 0; c < cell_count; ++c)
+  {
+    std::array<std::uint32_t, 4> indices{};
+    read(indices.data(), sizeof(indices));
+    auto const cell = tds.create_cell();
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const index = indices[static_cast<std::size_t>(i)];
+      if (index >= vertex_count)
+      {
+        status = Snapshot_status::CORRUPT;
+        break;
+      }
+      cell->set_vertex(i, vertices[index]);
+      vertices[index]->set_cell(cell);
+    }
+    cells.emplace_back(cell);
+    // The 4 vertices of a cell must be distinct
+    for (std::size_t i = 0; i < 4 && status == Snapshot_status::SUCCESS; ++i)
+    {
+      if (std::find(indices.begin() + static_cast<std::ptrdiff_t>(i) + 1,
+                    indices.end(), indices[i]) != indices.end())
+      {
+        status = Snapshot_status::CORRUPT;
+      }
+    }
+    if (status != Snapshot_status::SUCCESS) { break; }
+  }
+  for (std::size_t c = 0;
+       c < cell_count && status == Snapshot_status::SUCCESS; ++c)
+  {
+    std::array<std::uint32_t, 4> indices{};
+    read(indices.data(), sizeof(indices));
+    for (int i = 0; i < 4; ++i)
+    {
+      auto const index = indices[static_cast<std::size_t>(i)];
+      if (index >= cell_count)
+      {
+        status = Snapshot_status::CORRUPT;
+        break;
+      }
+      cells[c]->set_neighbor(i, cells[index]);
+    }
+  }
+
+  // Each neighbor must be glued back to the cell along the facet they
+  // share, or the result would not be a valid triangulation data structure
+  auto const is_glued = [](auto const& cell, int i) {
+    auto const neighbor = cell->neighbor(i);
+    int        mirror   = 0;
+    if (neighbor == cell || !neighbor->has_neighbor(cell, mirror))
+    {
+      return false;
+    }
+    for (int k = 0; k < 4; ++k)
+    {
+      int index = 0;
+      if (k != i &&
+          (!neighbor->has_vertex(cell->vertex(k), index) || index == mirror))
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+  for (std::size_t c = 0;
+       c < cell_count && status == Snapshot_status::SUCCESS; ++c)
+  {
+    for (int i = 0; i < 4; ++i)
+    {
+      if (!is_glued(cells[c], i))
+      {
+        status = Snapshot_status::CORRUPT;
+        break;
+      }
+    }
+  }
+  if constexpr (Has_info<typename Triangulation::Cell>)
+  {
+    if (status == Snapshot_status::SUCCESS)
+    {
+      for (auto const& cell : cells)
+      {
+        read(&cell->info(), sizeof(cell->info()));
+      }
+    }
+  }
+
+  // Every vertex must be in some cell
+  if (status == Snapshot_status::SUCCESS &&
+      std::any_of(vertices.begin(), vertices.end(), [](auto const& vertex) {
+        return vertex->cell() == Cell_handle_t<Triangulation>{};
+      }))
+  {
+    status = Snapshot_status::CORRUPT;
+  }
+  if (status != Snapshot_status::SUCCESS)
+  {
+    triangulation.clear();
+    return status;
+  }
+
+  tds.set_dimension(3);
+  triangulation.set_infinite_vertex(vertices.front());
+  return Snapshot_status::SUCCESS;
+}  // read_snapshot()
+
+/// @brief A read-only view of a whole file in memory
+/// @details The file is memory-mapped where POSIX mmap is available, so
+/// pages are read on demand and no copy is made. Elsewhere, e.g. on
+/// Windows, the file is read into a buffer instead.
+class Mapped_file
+{
+ public:
+  /// @param path The file to map
+  explicit Mapped_file(std::filesystem::path const& path)
+  {
+#ifndef _WIN32
+    auto const descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) { return; }
+    struct stat status
+    {};
+    if (::fstat(descriptor, &status) == 0 && status.st_size > 0)
+    {
+      auto const size = static_cast<std::size_t>(status.st_size);
+      auto*      data =
+          ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+      if (data != MAP_FAILED)
+      {
+        // The snapshot is read front to back exactly once
+        ::madvise(data, size, MADV_SEQUENTIAL);
+        m_data = static_cast<std::byte const*>(data);
+        m_size = size;
+      }
+    }
+    m_open = m_data != nullptr || status.st_size == 0;
+    ::close(descriptor);
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) { return; }
+    m_buffer.resize(static_cast<std::size_t>(in.tellg()));
+    in.seekg(0);
+    in.read(reinterpret_cast<char*>(m_buffer.data()),
+            static_cast<std::streamsize>(m_buffer.size()));
+    m_open = static_cast<bool>(in);
+    m_data = m_buffer.data();
+    m_size = m_buffer.size();
+#endif
+  }
+
+  Mapped_file(Mapped_file const&)                    = delete;
+  auto operator=(Mapped_file const&) -> Mapped_file& = delete;
+
+  ~Mapped_file()
+  {
+#ifndef _WIN32
+    if (m_data != nullptr)
+    {
+      ::munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+#endif
+  }
+
+  /// @return True if the file could be opened and read
+  explicit operator bool() const { return m_open; }
+
+  /// @return The contents of the file
+  [[nodiscard]] auto bytes() const -> std::span<std::byte const>
+  {
+    return {m_data, m_size};
+  }
+
+ private:
+  std::byte const* m_data{};
+  std::size_t      m_size{};
+  bool             m_open{};
+#ifdef _WIN32
+  std::vector<std::byte> m_buffer;
+#endif
+};
+
+/// @brief Load a triangulation from a snapshot file
+/// @param path The file to read
+/// @param triangulation The triangulation to build
+/// @return Whether the triangulation was loaded, or why not
+template <typename Triangulation>
+[[nodiscard]] auto load_snapshot(std::filesystem::path const& path,
+                                 Triangulation&               triangulation)
+    -> Snapshot_status
+{
+  Mapped_file const file(path);
+  if (!file) { return Snapshot_status::CANNOT_OPEN; }
+  return read_snapshot(file.bytes(), triangulation);
+}  // load_snapshot()
+
+#endif  // BISTELLAR_FLIP_TRIANGULATION_IO_HPP
@@ -0,0 +1,316 @@
+/// @file weighted_sampler.hpp
+/// @brief Propose pivot edges with non-uniform probability
+/// @author Adam Getchell
+/// @details A Fenwick tree (binary indexed tree) over per-edge weights
+/// samples an edge with probability proportional to its weight, and
+/// changes one weight, in O(log N). An alias table samples in O(1) but must
+/// be rebuilt in O(N) whenever a weight changes, which is after every flip.
+/// Weighted_edge_sampler keeps the pivot edges densely like
+/// Pivot_edge_index, with the weight of each in the tree, and after a flip
+/// recomputes the weights of only the edges of the new cells.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_WEIGHTED_SAMPLER_HPP
+#define BISTELLAR_FLIP_WEIGHTED_SAMPLER_HPP
+
+#include <bit>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <ranges>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "pivot_edge_index.hpp"
+
+/// @brief Prefix sums of non-negative weights with O(log N) updates
+class Fenwick_tree
+{
+ public:
+  /// @return The number of weights
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_weights.size();
+  }
+
+  /// @return The weight at a position
+  [[nodiscard]] auto weight(std::size_t position) const -> double
+  {
+    return m_weights[position];
+  }
+
+  /// @return The sum of all weights
+  [[nodiscard]] auto total() const -> double { return prefix(size()); }
+
+  /// @return The sum of the first count weights
+  [[nodiscard]] auto prefix(std::size_t count) const -> double
+  {
+    double sum = 0.0;
+    for (; count > 0; count &= count - 1) { sum += m_tree[count - 1]; }
+    return sum;
+  }
+
+  /// @brief Append a weight in O(log N)
+  void push_back(double weight)
+  {
+    // Node i covers the lowbit(i) positions ending at i; all but the last
+    // are already in the tree
+    auto const node = size() + 1;
+    auto const span = node & (~node + 1);
+    m_tree.push_back(weight + prefix(node - 1) - prefix(node - span));
+    m_weights.push_back(weight);
+  }
+
+  /// @brief Remove the last weight in O(1)
+  void pop_back()
+  {
+    m_tree.pop_back();
+    m_weights.pop_back();
+  }
+
+  /// @brief Change the weight at a position in O(log N)
+  void set(std::size_t position, double weight)
+  {
+    auto const delta    = weight - m_weights[position];
+    m_weights[position] = weight;
+    for (auto node = position + 1; node <= size(); node += node & (~node + 1))
+    {
+      m_tree[node - 1] += delta;
+    }
+  }
+
+  /// @brief Find the position whose weight covers a point of the total
+  /// @param target A value in [0, total())
+  /// @return The first position whose prefix sum including it exceeds
+  /// target, so each position is found with probability proportional to
+  /// its weight when target is uniform; size() - 1 if rounding overshoots
+  [[nodiscard]] auto find(double target) const -> std::size_t
+  {
+    std::size_t node = 0;
+    for (auto step = std::bit_floor(size()); step > 0; step >>= 1U)
+    {
+      if (node + step <= size() && m_tree[node + step - 1] <= target)
+      {
+        node += step;
+        target -= m_tree[node - 1];
+      }
+    }
+    // Skip trailing zero weights that rounding may have landed past
+    while (node < size() && m_weights[node] == 0.0) { ++node; }
+    return node < size() ? node : size() - 1;
+  }
+
+  /// @brief Recompute every prefix sum from the weights in O(N), removing
+  /// the rounding error accumulated by many updates
+  void rebuild()
+  {
+    m_tree = m_weights;
+    for (std::size_t node = 1; node <= size(); ++node)
+    {
+      auto const parent = node + (node & (~node + 1));
+      if (parent <= size()) { m_tree[parent - 1] += m_tree[node - 1]; }
+    }
+  }
+
+ private:
+  /// Node i, stored at i - 1, sums the lowbit(i) weights ending at i - 1
+  std::vector<double> m_tree;
+  std::vector<double> m_weights;
+};
+
+/// @brief Weigh every pivot edge equally
+struct Uniform_edge_weight
+{
+  template <typename Triangulation>
+  [[nodiscard]] auto operator()(
+      Triangulation const& /* triangulation */,
+      Edge_handle_t<Triangulation> const& /* edge */) const -> double
+  {
+    return 1.0;
+  }
+};
+
+/// @brief Pivot edges sampled with probability proportional to a weight
+/// @details Weight is called as weight(triangulation, edge) and must return
+/// a non-negative weight that depends only on the edge and its incident
+/// cells, e.g. their shape or the geometry of the octahedron. A flip
+/// changes only the incident cells of the edges of its new cells, so those
+/// are the only weights recomputed. A weight depending on more, such as
+/// vertex degrees, needs refresh() on the other affected edges as well.
+template <typename Triangulation, typename Weight = Uniform_edge_weight>
+class Basic_weighted_edge_sampler
+{
+ public:
+  using Edge_handle_type   = Edge_handle_t<Triangulation>;
+  using Vertex_handle_type = Vertex_handle_t<Triangulation>;
+  using Vertex_pair_type   = Basic_vertex_pair<Vertex_handle_type>;
+
+  /// @brief Weigh all pivot edges with one pass over the finite edges
+  /// @param triangulation The triangulation to sample from
+  /// @param weight The weight of each pivot edge
+  explicit Basic_weighted_edge_sampler(Triangulation const& triangulation,
+                                       Weight               weight = {})
+      : m_weight{std::move(weight)}
+  {
+    for (auto const& edge : pivot_edges_view(triangulation))
+    {
+      insert(make_vertex_pair(edge), edge, m_weight(triangulation, edge));
+    }
+  }
+
+  /// @return The number of pivot edges
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_edges.size();
+  }
+
+  /// @return True if there are no pivot edges
+  [[nodiscard]] auto empty() const noexcept -> bool { return m_edges.empty(); }
+
+  /// @return The sum of the weights of all pivot edges
+  [[nodiscard]] auto total_weight() const -> double
+  {
+    return m_weights.total();
+  }
+
+  /// @return The weight of the pivot edge between the two vertices, or 0
+  [[nodiscard]] auto weight(Vertex_handle_type const& first,
+                            Vertex_handle_type const& second) const -> double
+  {
+    auto const position = m_positions.find(make_vertex_pair(first, second));
+    if (position == m_positions.end()) { return 0.0; }
+    return m_weights.weight(position->second);
+  }
+
+  /// @return The pivot edge between the two vertices, or std::nullopt
+  [[nodiscard]] auto find(Vertex_handle_type const& first,
+                          Vertex_handle_type const& second) const
+      -> std::optional<Edge_handle_type>
+  {
+    auto const position = m_positions.find(make_vertex_pair(first, second));
+    if (position == m_positions.end()) { return std::nullopt; }
+    return m_edges[position->second];
+  }
+
+  /// @brief Choose a pivot edge with probability proportional to its
+  /// weight in O(log N)
+  /// @param generator A uniform random bit generator
+  /// @return A pivot edge, or std::nullopt if all weights are 0
+  template <typename Generator>
+  [[nodiscard]] auto sample(Generator& generator) const
+      -> std::optional<Edge_handle_type>
+  {
+    auto const total = m_weights.total();
+    if (m_edges.empty() || !(total > 0.0)) { return std::nullopt; }
+    std::uniform_real_distribution<double> distribution(0.0, total);
+    return m_edges[m_weights.find(distribution(generator))];
+  }
+
+  /// @brief Recount and reweigh one edge, adding or removing it
+  /// @param triangulation The triangulation containing the edge
+  /// @param edge The edge to refresh
+  void refresh(Triangulation const& triangulation, Edge_handle_type const& edge)
+  {
+    if (triangulation.is_infinite(edge.first->vertex(edge.second)) ||
+        triangulation.is_infinite(edge.first->vertex(edge.third)))
+    {
+      return;
+    }
+    auto const key = make_vertex_pair(edge);
+    if (is_pivot_edge(triangulation, edge))
+    {
+      insert(key, edge, m_weight(triangulation, edge));
+    }
+    else { erase(key); }
+  }
+
+  /// @brief Refresh every edge of the given cells
+  /// @param triangulation The triangulation containing the cells
+  /// @param cells The new cells of a move
+  template <std::ranges::input_range Range>
+  void refresh(Triangulation const& triangulation, Range const& cells)
+  {
+    for (auto const& cell : cells)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        for (int j = i + 1; j < 4; ++j)
+        {
+          refresh(triangulation, Edge_handle_type{cell, i, j});
+        }
+      }
+    }
+  }
+
+  /// @brief Update the weights after a successful bistellar flip
+  /// @details As Pivot_edge_index::update(), the old pivot edge is removed
+  /// and the edges of the 4 new cells are refreshed, each in O(log N).
+  /// @param triangulation The flipped triangulation
+  /// @param old_pivot The endpoints of the edge that was flipped
+  /// @param result The result of the flip
+  void update(Triangulation const& triangulation,
+              Vertex_pair_type const&                 old_pivot,
+              Basic_flip_result<Triangulation> const& result)
+  {
+    if (!result) { return; }
+    erase(old_pivot);
+    refresh(triangulation, result.cells);
+  }
+
+  /// @brief Remove an edge, e.g. one removed from the triangulation
+  /// @param key The endpoints of the edge
+  void erase(Vertex_pair_type const& key)
+  {
+    auto const position = m_positions.find(key);
+    if (position == m_positions.end()) { return; }
+    // Move the last edge into the hole so the arrays stay dense
+    auto const hole = position->second;
+    m_positions.erase(position);
+    if (hole != m_edges.size() - 1)
+    {
+      m_keys[hole]              = m_keys.back();
+      m_edges[hole]             = m_edges.back();
+      m_positions[m_keys[hole]] = hole;
+      m_weights.set(hole, m_weights.weight(m_weights.size() - 1));
+    }
+    m_keys.pop_back();
+    m_edges.pop_back();
+    m_weights.pop_back();
+  }
+
+  /// @brief Recompute the prefix sums, e.g. once per sweep, to remove the
+  /// rounding error accumulated by many updates
+  void rebuild() { m_weights.rebuild(); }
+
+ private:
+  void insert(Vertex_pair_type const& key, Edge_handle_type const& edge,
+              double weight)
+  {
+    auto const [position, inserted] = m_positions.try_emplace(key, size());
+    if (inserted)
+    {
+      m_keys.emplace_back(key);
+      m_edges.emplace_back(edge);
+      m_weights.push_back(weight);
+    }
+    else
+    {
+      m_edges[position->second] = edge;
+      m_weights.set(position->second, weight);
+    }
+  }
+
+  Weight                        m_weight;
+  std::vector<Vertex_pair_type> m_keys;
+  std::vector<Edge_handle_type> m_edges;
+  Fenwick_tree                  m_weights;
+  std::unordered_map<Vertex_pair_type, std::size_t, Vertex_pair_hash>
+      m_positions;
+};
+
+template <typename Weight = Uniform_edge_weight>
+using Weighted_edge_sampler = Basic_weighted_edge_sampler<Delaunay, Weight>;
+
+#endif  // BISTELLAR_FLIP_WEIGHTED_SAMPLER_HPP
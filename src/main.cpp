@@ -2,14 +2,132 @@
 /// @brief Performs bistellar fip
 /// @author Adam Getchell
 /// @details Show how to use the bistellar_flip functions on a 3D triangulation.
+/// Generates a reproducible random triangulation, e.g.
+///
+///     main --points 1000000 --distribution ball --seed 7 --flips 10000
+///
+/// then optionally runs a batch of flips on it and prints the report.
 /// @date Created: 2022-06-19
 
 #include <fmt/core.h>
 
+#include <charconv>
+#include <chrono>
+#include <cstdint>
 #include <cstdlib>
+#include <optional>
+#include <span>
+#include <string_view>
 
-int main()
+#include "flip_engine.hpp"
+#include "point_generators.hpp"
+
+namespace {
+  /// The command-line options
+  struct Options
+  {
+    std::size_t        points{10'000};
+    Point_distribution distribution{Point_distribution::CUBE};
+    std::uint64_t      seed{0};
+    std::size_t        flips{0};
+  };
+
+  /// @return The unsigned integer in text, or std::nullopt
+  template <typename Integer>
+  auto parse_number(std::string_view text) -> std::optional<Integer>
+  {
+    Integer value{};
+    auto const [end, error] =
+        std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} || end != text.data() + text.size())
+    {
+      return std::nullopt;
+    }
+    return value;
+  }
+
+  /// @return The options, or std::nullopt if any argument is invalid
+  auto parse_options(std::span<char* const> arguments)
+      -> std::optional<Options>
+  {
+    Options options;
+    for (std::size_t i = 1; i + 1 < arguments.size(); i += 2)
+    {
+      std::string_view const name  = arguments[i];
+      std::string_view const value = arguments[i + 1];
+      if (name == "--points")
+      {
+        auto const points = parse_number<std::size_t>(value);
+        if (!points) { return std::nullopt; }
+        options.points = *points;
+      }
+      else if (name == "--distribution")
+      {
+        auto const distribution = parse_point_distribution(value);
+        if (!distribution) { return std::nullopt; }
+        options.distribution = *distribution;
+      }
+      else if (name == "--seed")
+      {
+        auto const seed = parse_number<std::uint64_t>(value);
+        if (!seed) { return std::nullopt; }
+        options.seed = *seed;
+      }
+      else if (name == "--flips")
+      {
+        auto const flips = parse_number<std::size_t>(value);
+        if (!flips) { return std::nullopt; }
+        options.flips = *flips;
+      }
+      else { return std::nullopt; }
+    }
+    // Every option takes a value
+    if (arguments.size() % 2 == 0) { return std::nullopt; }
+    return options;
+  }
+
+  void print_usage()
+  {
+    fmt::print(
+        "Usage: main [--points N] [--distribution cube|ball|shell|lattice]\n"
+        "            [--seed S] [--flips F]\n");
+  }
+}  // namespace
+
+int main(int argc, char* argv[])
 {
-  fmt::print("Hello, world!\n");
+  auto const options = parse_options(
+      std::span<char* const>(argv, static_cast<std::size_t>(argc)));
+  if (!options)
+  {
+    print_usage();
+    return EXIT_FAILURE;
+  }
+
+  using Clock   = std::chrono::steady_clock;
+  using Seconds = std::chrono::duration<double>;
+
+  auto const start  = Clock::now();
+  auto       points = generate_points(options->distribution, options->points,
+                                      options->seed);
+  auto const generated     = Clock::now();
+  auto       triangulation = make_delaunay(points);
+  auto const triangulated  = Clock::now();
+
+  fmt::print("Generated {} points in a {} with seed {} in {:.3f} s\n",
+             options->points, to_string(options->distribution), options->seed,
+             Seconds(generated - start).count());
+  fmt::print("Triangulated {} vertices and {} finite cells in {:.3f} s\n",
+             triangulation.number_of_vertices(),
+             triangulation.number_of_finite_cells(),
+             Seconds(triangulated - generated).count());
+
+  if (options->flips > 0)
+  {
+    Flip_engine         engine(triangulation, options->seed);
+    Flip_engine_options run_options;
+    run_options.target_flips = options->flips;
+    print_report(engine.run(run_options));
+  }
   return EXIT_SUCCESS;
 }
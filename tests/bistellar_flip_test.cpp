@@ -10,7 +10,14 @@
 #include <doctest/doctest.h>
 #include <gmpxx.h>
 
+#include <algorithm>
+#include <concepts>
 #include <numbers>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+#include "random_triangulation.hpp"
 
 static inline std::floating_point auto constexpr SQRT_2 =
     std::numbers::sqrt2_v<double>;
@@ -72,6 +79,40 @@ SCENARIO("Test Delaunay triangulation convenience functions" *
         REQUIRE_EQ(vertices.size(), 6);
       }
     }
+    WHEN("We view the finite simplices lazily")
+    {
+      auto cells    = finite_cells_view(triangulation);
+      auto vertices = finite_vertices_view(triangulation);
+      THEN("The views are forward ranges of handles")
+      {
+        static_assert(std::ranges::forward_range<decltype(cells)>);
+        static_assert(std::ranges::view<decltype(cells)>);
+        static_assert(std::same_as<std::ranges::range_value_t<decltype(cells)>,
+                                   Cell_handle>);
+        static_assert(
+            std::same_as<std::ranges::range_value_t<decltype(vertices)>,
+                         Vertex_handle>);
+      }
+      THEN("They hold the same simplices as the containers")
+      {
+        CHECK(std::ranges::equal(cells, get_finite_cells(triangulation)));
+        CHECK(std::ranges::equal(finite_edges_view(triangulation), edges,
+                                 [](auto const& lhs, auto const& rhs) {
+                                   return lhs.first == rhs.first &&
+                                          lhs.second == rhs.second &&
+                                          lhs.third == rhs.third;
+                                 }));
+        CHECK(std::ranges::equal(vertices, get_finite_vertices(triangulation)));
+      }
+      THEN("Edges can be filtered to the pivot edges")
+      {
+        auto pivot_edges = pivot_edges_view(triangulation);
+        CHECK_EQ(std::ranges::distance(pivot_edges), 1);
+        auto pivot_edge = find_pivot_edge(triangulation);
+        REQUIRE(pivot_edge);
+        CHECK_EQ(count_finite_incident_cells(triangulation, *pivot_edge), 4);
+      }
+    }
   }
 }
 
@@ -91,6 +132,15 @@ SCENARIO("Perform bistellar flip on Delaunay triangulation" *
     };
     Delaunay triangulation(points.begin(), points.end());
     CHECK(triangulation.is_valid());
+    // Find the handle of an existing vertex, without inserting its point
+    auto vertex_at = [&triangulation](Point const& point) {
+      auto vertices = finite_vertices_view(triangulation);
+      auto vertex   = std::ranges::find_if(vertices, [&](auto const& v) {
+        return v->point() == point;
+      });
+      REQUIRE(vertex != vertices.end());
+      return *vertex;
+    };
     WHEN("We find the pivot edge in the triangulation")
     {
       auto pivot_edge =
@@ -112,21 +162,278 @@ SCENARIO("Perform bistellar flip on Delaunay triangulation" *
         auto vertices = get_vertices(incident_cells.value());
         REQUIRE_EQ(vertices.size(), 6);
       }
+      THEN("We can gather the octahedron without allocating")
+      {
+        auto cells = get_octahedron_cells(triangulation, pivot_edge.value());
+        REQUIRE(cells);
+        CHECK(std::ranges::is_permutation(cells.value(),
+                                          incident_cells.value()));
+        auto vertices = get_octahedron_vertices(cells.value());
+        REQUIRE(vertices);
+        CHECK(std::ranges::is_permutation(
+            vertices.value(), get_vertices(incident_cells.value())));
+      }
+      THEN("Edges on the boundary are not octahedral")
+      {
+        auto edges = get_finite_edges(triangulation);
+        auto boundary_edge =
+            std::ranges::find_if(edges, [&](auto const& edge) {
+              return count_finite_incident_cells(triangulation, edge) != 4;
+            });
+        REQUIRE(boundary_edge != edges.end());
+        CHECK_FALSE(get_octahedron_cells(triangulation, *boundary_edge));
+      }
       THEN("We can perform a bistellar flip")
       {
-        // Obtain top and bottom vertices by re-inserting, which returns the
-        // Vertex_handle
-        auto top    = triangulation.insert(Point(0, 0, 2));
-        auto bottom = triangulation.insert(Point(0, 0, 0));
-        // Check this didn't actually change vertices in the triangulation
-        REQUIRE_EQ(points.size(), 6);
-        auto flipped_triangulation =
+        auto top    = vertex_at(Point(0, 0, 2));
+        auto bottom = vertex_at(Point(0, 0, 0));
+        auto number_of_cells = triangulation.number_of_cells();
+        auto result =
             bistellar_flip(triangulation, pivot_edge.value(), top, bottom);
-        REQUIRE(flipped_triangulation);
-        /// FIXME: This fails because the triangulation is not valid any more
-        /// neighbor of c has not c as neighbor
-        WARN(flipped_triangulation->is_valid());
+        REQUIRE(result);
+        // The flip is done in place and keeps the combinatorics valid
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(triangulation.number_of_cells(), number_of_cells);
+        CHECK(std::all_of(
+            result.cells.begin(), result.cells.end(),
+            [&](auto const& cell) { return triangulation.tds().is_cell(cell); }));
+        // The new pivot edge has 4 incident cells and avoids top and bottom
+        REQUIRE_EQ(get_incident_cells(triangulation, result.pivot_edge)->size(),
+                   4);
+        auto pivot_to_1 = result.pivot_edge.first->vertex(result.pivot_edge.second);
+        auto pivot_to_2 = result.pivot_edge.first->vertex(result.pivot_edge.third);
+        CHECK_NE(pivot_to_1, top);
+        CHECK_NE(pivot_to_2, bottom);
+        // The flipped triangulation need not be Delaunay
+        WARN(triangulation.is_valid());
+      }
+      THEN("A flip validated against the whole triangulation succeeds")
+      {
+        auto top    = vertex_at(Point(0, 0, 2));
+        auto bottom = vertex_at(Point(0, 0, 0));
+        auto result = bistellar_flip(triangulation, pivot_edge.value(), top,
+                                     bottom, Flip_validation::GLOBAL);
+        REQUIRE(result);
+        CHECK(is_locally_valid(triangulation, result.cells));
+      }
+      THEN("The flip reuses the old cells instead of creating new ones")
+      {
+        auto top       = vertex_at(Point(0, 0, 2));
+        auto bottom    = vertex_at(Point(0, 0, 0));
+        auto old_cells = incident_cells.value();
+        auto result =
+            bistellar_flip(triangulation, pivot_edge.value(), top, bottom);
+        REQUIRE(result);
+        CHECK(std::ranges::is_permutation(result.cells, old_cells));
+      }
+      THEN("Orientation of the new cells is repaired locally")
+      {
+        auto top    = vertex_at(Point(0, 0, 2));
+        auto bottom = vertex_at(Point(0, 0, 0));
+        auto result =
+            bistellar_flip(triangulation, pivot_edge.value(), top, bottom);
+        REQUIRE(result);
+        change_orientation(result.cells[0]);
+        change_orientation(result.cells[2]);
+        REQUIRE_FALSE(is_locally_valid(triangulation, result.cells));
+        reorient_locally(result.cells);
+        CHECK(is_locally_valid(triangulation, result.cells));
+        CHECK(triangulation.tds().is_valid());
+      }
+      THEN("The octahedron has the pivot edge and 2 ring diagonals")
+      {
+        auto diagonals =
+            get_octahedron_diagonals(triangulation, pivot_edge.value());
+        REQUIRE(diagonals);
+        auto const& [pivot, first, second] = diagonals.value();
+        CHECK_EQ(pivot.first, pivot_edge->first->vertex(pivot_edge->second));
+        CHECK_EQ(pivot.second, pivot_edge->first->vertex(pivot_edge->third));
+        // Opposite vertices of the ring share no cell
+        for (auto const& [top, bottom] : {first, second})
+        {
+          CHECK(std::ranges::none_of(
+              incident_cells.value(), [&](auto const& cell) {
+                return cell->has_vertex(top) && cell->has_vertex(bottom);
+              }));
+        }
+        // The top and bottom used above are one of the ring diagonals
+        auto top    = vertex_at(Point(0, 0, 2));
+        auto bottom = vertex_at(Point(0, 0, 0));
+        CHECK(((first.first == top && first.second == bottom) ||
+               (first.first == bottom && first.second == top) ||
+               (second.first == top && second.second == bottom) ||
+               (second.first == bottom && second.second == top)));
+      }
+      THEN("A flip can choose its own top and bottom vertices")
+      {
+        auto diagonals =
+            get_octahedron_diagonals(triangulation, pivot_edge.value());
+        REQUIRE(diagonals);
+        auto number_of_cells = triangulation.number_of_cells();
+        auto result = bistellar_flip(triangulation, pivot_edge.value());
+        REQUIRE(result);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(triangulation.number_of_cells(), number_of_cells);
+        // The new pivot edge is one of the ring diagonals
+        auto pivot_to_1 =
+            result.pivot_edge.first->vertex(result.pivot_edge.second);
+        auto pivot_to_2 =
+            result.pivot_edge.first->vertex(result.pivot_edge.third);
+        auto const& [pivot, first, second] = diagonals.value();
+        CHECK(std::ranges::any_of(
+            std::array{first, second}, [&](auto const& diagonal) {
+              return (diagonal.first == pivot_to_1 &&
+                      diagonal.second == pivot_to_2) ||
+                     (diagonal.first == pivot_to_2 &&
+                      diagonal.second == pivot_to_1);
+            }));
+      }
+      THEN("Both choices of top and bottom vertices can be planned")
+      {
+        auto plans = plan_flips(triangulation, pivot_edge.value());
+        CHECK(std::ranges::any_of(
+            plans, [](auto const& plan) { return static_cast<bool>(plan); }));
+        for (auto const& plan : plans)
+        {
+          if (!plan) { continue; }
+          CHECK_NE(plan.pivot_to_1, plan.pivot_to_2);
+          CHECK(std::ranges::none_of(plan.vertices(), [&](auto const& v) {
+            return v == Vertex_handle{};
+          }));
+        }
+        // Planning does not modify the triangulation
+        CHECK(triangulation.is_valid());
+      }
+      THEN("A flip with the same top and bottom vertex is rejected")
+      {
+        auto top             = vertex_at(Point(0, 0, 2));
+        auto number_of_cells = triangulation.number_of_cells();
+        auto result =
+            bistellar_flip(triangulation, pivot_edge.value(), top, top);
+        REQUIRE_FALSE(result);
+        CHECK_EQ(result.status, Flip_status::WRONG_PIVOT_VERTEX_COUNT);
+        CHECK_EQ(triangulation.number_of_cells(), number_of_cells);
+        CHECK(triangulation.is_valid());
+      }
+    }
+  }
+}
+SCENARIO("Check the geometry of a flip before applying it" *
+         doctest::test_suite("bistellar_flip"))
+{
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto triangulation = make_random_triangulation(60, 21);
+    // Find a plan that would invert a cell, and one that would not
+    std::optional<Flip_plan> inverting;
+    std::optional<Flip_plan> valid;
+    for (auto const& edge : get_finite_edges(triangulation))
+    {
+      for (auto const& plan : plan_flips(triangulation, edge))
+      {
+        if (!plan) { continue; }
+        if (is_geometrically_valid(plan)) { valid.emplace(plan); }
+        else { inverting.emplace(plan); }
+      }
+    }
+    REQUIRE(inverting);
+    REQUIRE(valid);
+    THEN("A flip that would invert a cell is rejected without changes")
+    {
+      auto const cells = inverting->cells;
+      std::array<std::array<Vertex_handle, 4>, 4> vertices{};
+      for (std::size_t c = 0; c < 4; ++c)
+      {
+        for (int i = 0; i < 4; ++i)
+        {
+          vertices[c][static_cast<std::size_t>(i)] = cells[c]->vertex(i);
+        }
+      }
+      auto const result =
+          apply_flip(triangulation, *inverting, Flip_validation::GEOMETRIC);
+      REQUIRE_FALSE(result);
+      CHECK_EQ(result.status, Flip_status::INVERTED_CELL);
+      for (std::size_t c = 0; c < 4; ++c)
+      {
+        for (int i = 0; i < 4; ++i)
+        {
+          CHECK_EQ(cells[c]->vertex(i),
+                   vertices[c][static_cast<std::size_t>(i)]);
+        }
+      }
+      CHECK(triangulation.is_valid());
+    }
+    THEN("A flip that keeps every cell positive succeeds")
+    {
+      auto const result =
+          apply_flip(triangulation, *valid, Flip_validation::GEOMETRIC);
+      REQUIRE(result);
+      CHECK(triangulation.tds().is_valid());
+      for (auto const& cell : result.cells)
+      {
+        CHECK_EQ(CGAL::orientation(
+                     cell->vertex(0)->point(), cell->vertex(1)->point(),
+                     cell->vertex(2)->point(), cell->vertex(3)->point()),
+                 CGAL::POSITIVE);
       }
     }
   }
-}
\ No newline at end of file
+}
+
+SCENARIO("Roll back a flip that fails validation" *
+         doctest::test_suite("bistellar_flip"))
+{
+  GIVEN("A triangulation with one misoriented cell away from a pivot edge")
+  {
+    auto triangulation = make_random_triangulation(60, 22);
+    auto const edge = find_pivot_edge(triangulation);
+    REQUIRE(edge);
+    auto const plans = plan_flips(triangulation, *edge);
+    auto const plan  = std::ranges::find_if(plans, [](auto const& candidate) {
+      return static_cast<bool>(candidate);
+    });
+    REQUIRE(plan != plans.end());
+    // Global validation fails on a cell the flip does not touch
+    auto const cells   = get_finite_cells(triangulation);
+    auto const distant = std::ranges::find_if(cells, [&](auto const& cell) {
+      return std::ranges::find(plan->cells, cell) == plan->cells.end() &&
+             std::ranges::find(plan->neighbors, cell) == plan->neighbors.end();
+    });
+    REQUIRE(distant != cells.end());
+    change_orientation(*distant);
+    REQUIRE_FALSE(triangulation.tds().is_valid());
+    WHEN("The flip is validated against the whole triangulation")
+    {
+      std::array<std::array<Vertex_handle, 4>, 4> vertices{};
+      std::array<std::array<Cell_handle, 4>, 4>   neighbors{};
+      for (std::size_t c = 0; c < 4; ++c)
+      {
+        for (int i = 0; i < 4; ++i)
+        {
+          vertices[c][static_cast<std::size_t>(i)] = plan->cells[c]->vertex(i);
+          neighbors[c][static_cast<std::size_t>(i)] =
+              plan->cells[c]->neighbor(i);
+        }
+      }
+      auto const result =
+          apply_flip(triangulation, *plan, Flip_validation::GLOBAL);
+      THEN("It is rejected and the cells are left as they were")
+      {
+        REQUIRE_FALSE(result);
+        CHECK_EQ(result.status, Flip_status::INVALID_CELL);
+        for (std::size_t c = 0; c < 4; ++c)
+        {
+          for (int i = 0; i < 4; ++i)
+          {
+            CHECK_EQ(plan->cells[c]->vertex(i),
+                     vertices[c][static_cast<std::size_t>(i)]);
+            CHECK_EQ(plan->cells[c]->neighbor(i),
+                     neighbors[c][static_cast<std::size_t>(i)]);
+          }
+        }
+        change_orientation(*distant);
+        CHECK(triangulation.is_valid());
+      }
+    }
+  }
+}
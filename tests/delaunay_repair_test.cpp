@@ -0,0 +1,181 @@
+/// @file delaunay_repair_test.cpp
+/// @brief Track and restore the Delaunay property after flips
+/// @author Adam Getchell
+/// @details Test functions defined in delaunay_repair.hpp, and their use by
+/// the flip engine
+/// @date 2026-10-16
+
+#include "delaunay_repair.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "flip_engine.hpp"
+#include "flip_journal.hpp"
+#include "random_triangulation.hpp"
+#include "star_cache.hpp"
+
+namespace {
+  /// Count pivot edges the slow way, by scanning every finite edge
+  auto count_pivot_edges(Delaunay const& triangulation) -> std::size_t
+  {
+    auto edges = get_finite_edges(triangulation);
+    return static_cast<std::size_t>(
+        std::count_if(edges.begin(), edges.end(), [&](auto const& edge) {
+          return get_octahedron_cells(triangulation, edge).has_value();
+        }));
+  }
+
+  /// Whether every finite cell is locally Delaunay, the slow way
+  auto is_delaunay_everywhere(Delaunay const& triangulation) -> bool
+  {
+    auto const cells = finite_cells_view(triangulation);
+    return std::all_of(cells.begin(), cells.end(), [&](auto const& cell) {
+      return is_locally_delaunay(triangulation, cell);
+    });
+  }
+
+  /// Make random flips whose new cells are positively oriented, undoing any
+  /// others, and mark them
+  auto flip_positively(Delaunay& triangulation, Delaunay_repair& repair,
+                       std::size_t count, std::uint64_t seed) -> std::size_t
+  {
+    std::mt19937_64 generator(seed);
+    Flip_journal    journal;
+    std::size_t     flips = 0;
+    for (std::size_t attempt = 0; attempt < 100 * count && flips < count;
+         ++attempt)
+    {
+      auto const edge = Pivot_edge_index(triangulation).sample(generator);
+      if (!edge) { break; }
+      auto const cells = get_octahedron_cells(triangulation, *edge);
+      if (!cells) { continue; }
+      auto const top_and_bottom =
+          choose_top_and_bottom(*cells, *edge, generator);
+      if (!top_and_bottom) { continue; }
+      auto const result = journal.flip(triangulation, *edge,
+                                       top_and_bottom->first,
+                                       top_and_bottom->second);
+      if (!result) { continue; }
+      if (!std::all_of(result.cells.begin(), result.cells.end(),
+                       [](auto const& cell) {
+                         return CGAL::orientation(cell->vertex(0)->point(),
+                                                  cell->vertex(1)->point(),
+                                                  cell->vertex(2)->point(),
+                                                  cell->vertex(3)->point()) ==
+                                CGAL::POSITIVE;
+                       }))
+      {
+        (void)journal.undo(triangulation);
+        continue;
+      }
+      repair.mark(result.cells);
+      ++flips;
+    }
+    return flips;
+  }
+}  // namespace
+
+SCENARIO("Check facets for the Delaunay property" *
+         doctest::test_suite("delaunay_repair"))
+{
+  GIVEN("A Delaunay triangulation")
+  {
+    auto triangulation = make_random_triangulation(40, 11);
+    THEN("Every facet is locally Delaunay")
+    {
+      CHECK(is_delaunay_everywhere(triangulation));
+    }
+    WHEN("Every cell is queued and checked")
+    {
+      Delaunay_repair repair(triangulation);
+      repair.mark_all();
+      CHECK_EQ(repair.size(), triangulation.number_of_finite_cells());
+      THEN("No cell is left in the queue")
+      {
+        CHECK(repair.is_delaunay());
+        CHECK(repair.empty());
+      }
+    }
+  }
+}
+
+SCENARIO("Restore the Delaunay property after flips" *
+         doctest::test_suite("delaunay_repair"))
+{
+  GIVEN("A Delaunay triangulation and an empty queue")
+  {
+    auto            triangulation = make_random_triangulation(60, 12);
+    Delaunay_repair repair(triangulation);
+    WHEN("Flips that keep every cell positively oriented are marked")
+    {
+      auto const flips = flip_positively(triangulation, repair, 30, 13);
+      REQUIRE_EQ(flips, 30);
+      THEN("The queue holds only cells of the flips")
+      {
+        CHECK_LE(repair.size(), 4 * flips);
+      }
+      THEN("The queue finds the facets that are no longer Delaunay")
+      {
+        CHECK_FALSE(is_delaunay_everywhere(triangulation));
+        CHECK_FALSE(repair.is_delaunay());
+      }
+      AND_WHEN("The Delaunay property is restored")
+      {
+        auto const report = repair.restore();
+        THEN("The triangulation is Delaunay again")
+        {
+          CHECK_GT(report.moves(), 0);
+          CHECK_EQ(report.remaining, 0);
+          CHECK(repair.empty());
+          CHECK(triangulation.tds().is_valid());
+          CHECK(is_delaunay_everywhere(triangulation));
+          CHECK(triangulation.is_valid());
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Track the Delaunay property in the flip engine" *
+         doctest::test_suite("delaunay_repair"))
+{
+  GIVEN("A flip engine tracking a Delaunay triangulation")
+  {
+    auto        triangulation = make_random_triangulation(60, 14);
+    Flip_engine engine(triangulation, 15);
+    auto&       repair = engine.track_delaunay();
+    engine.track_stars();
+    WHEN("Some flips are made and the Delaunay property is restored")
+    {
+      Flip_engine_options options;
+      options.target_flips = 10;
+      REQUIRE_EQ(engine.run(options).flips, 10);
+      CHECK_LE(repair.size(), 40);
+      auto const report = engine.restore_delaunay();
+      THEN("Only the cells the engine could not repair remain queued")
+      {
+        CHECK_EQ(repair.check(), report.remaining);
+        CHECK(triangulation.tds().is_valid());
+      }
+      THEN("The index of pivot edges is up to date")
+      {
+        CHECK_EQ(engine.index().size(), count_pivot_edges(triangulation));
+      }
+      THEN("The star sums match a fresh count")
+      {
+        Star_cache<Delaunay> const fresh(triangulation);
+        REQUIRE(engine.stars());
+        CHECK_EQ(engine.stars()->sums(), fresh.sums());
+      }
+      THEN("Flipping can continue")
+      {
+        CHECK_EQ(engine.run(options).flips, 10);
+        CHECK(triangulation.tds().is_valid());
+      }
+    }
+  }
+}
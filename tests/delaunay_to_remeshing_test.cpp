@@ -1,18 +1,16 @@
 /// @file delaunay_to_remeshing_test.cpp
 /// @brief Convert Delaunay_triangulation_3 to Remeshing_triangulation_3
 /// @author Adam Getchell
-/// @details Convert the relevant data structures, particularly edges and cells,
-/// from the Delaunay_triangulation_3 versions to the Remeshing_triangulation_3
-/// versions so that we can use the CGAL::flip_n_to_m function.
+/// @details Lend the cells and vertices of a Delaunay_triangulation_3 to a
+/// Remeshing_triangulation_3 without copying them, so that we can use the
+/// CGAL::flip_n_to_m function. Test functions defined in remeshing_adapter.hpp
 /// @date 2022-10-20
 
 #include <CGAL/assertions.h>
-#include <CGAL/Cartesian_converter.h>
 #include <CGAL/Compact_container.h>
 #include <CGAL/enum.h>
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Interval_nt.h>
-#include <CGAL/Mesh_complex_3_in_triangulation_3.h>
 #include <CGAL/Mpzf.h>
 #include <CGAL/Point_3.h>
 #include <CGAL/Tetrahedral_remeshing/Remeshing_triangulation_3.h>
@@ -24,10 +22,7 @@
 #include <vector>
 
 #include "bistellar_flip.hpp"
-
-using Remeshing_triangulation =
-    CGAL::Tetrahedral_remeshing::Remeshing_triangulation_3<K>;
-using C3T3 = CGAL::Mesh_complex_3_in_triangulation_3<Remeshing_triangulation>;
+#include "remeshing_adapter.hpp"
 
 static inline std::floating_point auto constexpr SQRT_2 =
     std::numbers::sqrt2_v<double>;
@@ -47,11 +42,36 @@ SCENARIO("Perform bistellar flip on Delaunay triangulation using CGAL " *
         Point{          0, -INV_SQRT_2, INV_SQRT_2},
         Point{          0,           0,          2}
     };
-    Delaunay triangulation(points.begin(), points.end());
+    Remeshable_delaunay triangulation(points.begin(), points.end());
     CHECK(triangulation.is_valid());
-    //    Remeshing_triangulation tr =
-    //    CGAL::tetrahedron_soup_to_triangulation_3<Remeshing_triangulation>(triangulation.tds().finite_edges_begin(),
-    //    triangulation.tds().finite_edges_end()); C3T3 c3t3;
-    //    c3t3.triangulation() = tr;
+    auto const cells    = triangulation.number_of_cells();
+    auto const vertices = triangulation.number_of_vertices();
+    auto const first    = *triangulation.finite_cell_handles().begin();
+    WHEN("It is lent to a remeshing triangulation")
+    {
+      {
+        Remeshing_adapter adapter(triangulation);
+        THEN("The remeshing triangulation has the same cells and vertices")
+        {
+          auto& remeshing = adapter.triangulation();
+          CHECK_EQ(remeshing.number_of_cells(), cells);
+          CHECK_EQ(remeshing.number_of_vertices(), vertices);
+          CHECK(remeshing.tds().is_cell(first));
+          CHECK_EQ(adapter.complex().number_of_cells_in_complex(),
+                   remeshing.number_of_finite_cells());
+        }
+        THEN("The Delaunay triangulation is empty while it is lent")
+        {
+          CHECK_EQ(triangulation.number_of_vertices(), 0);
+        }
+      }
+      THEN("It is given back unchanged")
+      {
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+        CHECK_EQ(triangulation.number_of_vertices(), vertices);
+        CHECK(triangulation.tds().is_cell(first));
+        CHECK(triangulation.is_valid());
+      }
+    }
   }
-}
\ No newline at end of file
+}
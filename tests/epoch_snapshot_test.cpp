@@ -0,0 +1,206 @@
+/// @file epoch_snapshot_test.cpp
+/// @brief Publish snapshots of a triangulation to analysis threads
+/// @author Adam Getchell
+/// @details Test functions defined in epoch_snapshot.hpp and the snapshot
+/// interval of Flip_engine
+/// @date 2026-10-16
+
+#include "epoch_snapshot.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "flip_engine.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// @return True if every cell has 4 vertices and is its neighbors'
+  /// neighbor, i.e. the snapshot was not taken partway through a flip
+  auto is_consistent(Soa_snapshot const& snapshot) -> bool
+  {
+    auto const counts = incident_cell_counts(snapshot);
+    if (std::accumulate(counts.begin(), counts.end(), std::size_t{0}) !=
+        4 * snapshot.number_of_cells())
+    {
+      return false;
+    }
+    for (std::size_t c = 0; c < snapshot.number_of_cells(); ++c)
+    {
+      for (std::size_t i = 0; i < 4; ++i)
+      {
+        auto const neighbor = snapshot.cell_neighbors[i][c];
+        auto       found    = false;
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+          found = found || snapshot.cell_neighbors[j][neighbor] == c;
+        }
+        if (!found) { return false; }
+      }
+    }
+    return true;
+  }
+}  // namespace
+
+SCENARIO("Publish snapshots of a triangulation" *
+         doctest::test_suite("epoch_snapshot"))
+{
+  GIVEN("A publisher and a triangulation")
+  {
+    auto               triangulation = make_random_triangulation(60, 81);
+    Snapshot_publisher publisher;
+    THEN("Nothing is published at first")
+    {
+      CHECK_EQ(publisher.epoch(), 0);
+      CHECK_FALSE(publisher.latest());
+    }
+    WHEN("The triangulation is published")
+    {
+      REQUIRE_EQ(publisher.publish(triangulation, 5), 1);
+      auto const latest = publisher.latest();
+      THEN("The latest snapshot is a copy of it")
+      {
+        REQUIRE(latest);
+        CHECK_EQ(latest->epoch, 1);
+        CHECK_EQ(latest->flips, 5);
+        auto const expected = make_soa_snapshot(triangulation);
+        CHECK_EQ(latest->snapshot.x, expected.x);
+        CHECK_EQ(latest->snapshot.cell_vertices, expected.cell_vertices);
+        CHECK_EQ(latest->snapshot.cell_neighbors, expected.cell_neighbors);
+      }
+      THEN("A reader waiting for a newer one gets it at once")
+      {
+        CHECK_EQ(publisher.wait_newer(0), latest);
+      }
+    }
+    WHEN("It is published again with no reader holding the old snapshot")
+    {
+      static_cast<void>(publisher.publish(triangulation));
+      auto const* const first = publisher.latest().get();
+      static_cast<void>(publisher.publish(triangulation));
+      static_cast<void>(publisher.publish(triangulation));
+      THEN("The two buffers are reused in turn")
+      {
+        CHECK_EQ(publisher.epoch(), 3);
+        CHECK_EQ(publisher.latest().get(), first);
+      }
+    }
+    WHEN("A reader holds a snapshot while flipping continues")
+    {
+      static_cast<void>(publisher.publish(triangulation));
+      auto const held  = publisher.latest();
+      auto const cells = held->snapshot.cell_vertices;
+
+      Flip_engine         engine(triangulation, 82);
+      Flip_engine_options options;
+      options.target_flips = 20;
+      REQUIRE_GT(engine.run(options).flips, 0);
+      static_cast<void>(publisher.publish(triangulation));
+      static_cast<void>(publisher.publish(triangulation));
+      THEN("The held snapshot is unchanged")
+      {
+        CHECK_EQ(held->epoch, 1);
+        CHECK_EQ(held->snapshot.cell_vertices, cells);
+        CHECK_NE(publisher.latest(), held);
+        CHECK_EQ(publisher.latest()->snapshot.cell_vertices,
+                 make_soa_snapshot(triangulation).cell_vertices);
+      }
+    }
+    WHEN("A reader on another thread releases a snapshot it held")
+    {
+      static_cast<void>(publisher.publish(triangulation));
+      auto        held    = publisher.latest();
+      auto const* address = held.get();
+      static_cast<void>(publisher.publish(triangulation));
+      static_cast<void>(publisher.publish(triangulation));
+      std::thread([snapshot = std::move(held)]() mutable {
+        snapshot.reset();
+      }).join();
+      static_cast<void>(publisher.publish(triangulation));
+      THEN("Its buffer is handed back and refilled by the next publish")
+      {
+        CHECK_EQ(publisher.latest().get(), address);
+        CHECK_EQ(publisher.latest()->epoch, 4);
+        CHECK_EQ(publisher.latest()->snapshot.cell_neighbors,
+                 make_soa_snapshot(triangulation).cell_neighbors);
+      }
+    }
+    WHEN("A snapshot is held after the publisher is destroyed")
+    {
+      Snapshot_publisher::Snapshot_pointer held;
+      {
+        Snapshot_publisher temporary;
+        static_cast<void>(temporary.publish(triangulation, 3));
+        held = temporary.latest();
+      }
+      THEN("It is still readable")
+      {
+        REQUIRE(held);
+        CHECK_EQ(held->flips, 3);
+        CHECK_EQ(held->snapshot.number_of_cells(),
+                 triangulation.tds().number_of_cells());
+      }
+    }
+    WHEN("The publisher is closed")
+    {
+      publisher.close();
+      THEN("A waiting reader is released")
+      {
+        CHECK_FALSE(publisher.wait_newer(0));
+      }
+    }
+  }
+}
+
+SCENARIO("Measure snapshots while flipping" *
+         doctest::test_suite("epoch_snapshot"))
+{
+  GIVEN("A flip engine publishing snapshots and an analysis thread")
+  {
+    auto                triangulation = make_random_triangulation(60, 83);
+    Flip_engine         engine(triangulation, 84);
+    Snapshot_publisher  publisher;
+    Flip_engine_options options;
+    options.target_flips      = 60;
+    options.snapshot_interval = 10;
+    engine.publish_snapshots(publisher);
+
+    std::vector<std::uint64_t> epochs;
+    std::vector<std::size_t>   flips;
+    std::vector<bool>          consistent;
+    std::thread                reader([&] {
+      std::uint64_t epoch = 0;
+      while (auto const latest = publisher.wait_newer(epoch))
+      {
+        epoch = latest->epoch;
+        epochs.push_back(epoch);
+        flips.push_back(latest->flips);
+        consistent.push_back(is_consistent(latest->snapshot));
+        static_cast<void>(sweep_statistics(latest->snapshot));
+      }
+    });
+    WHEN("The engine runs")
+    {
+      auto const report = engine.run(options);
+      publisher.close();
+      reader.join();
+      THEN("Every snapshot read is consistent and newer than the last")
+      {
+        REQUIRE_EQ(report.flips, 60);
+        CHECK_EQ(report.snapshots, 6);
+        CHECK_EQ(publisher.epoch(), 6);
+        REQUIRE_FALSE(epochs.empty());
+        CHECK(std::is_sorted(epochs.begin(), epochs.end()));
+        CHECK(std::is_sorted(flips.begin(), flips.end()));
+        CHECK_EQ(epochs.back(), 6);
+        CHECK_EQ(flips.back(), 60);
+        CHECK(std::all_of(consistent.begin(), consistent.end(),
+                          [](bool value) { return value; }));
+      }
+    }
+  }
+}
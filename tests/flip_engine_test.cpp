@@ -0,0 +1,107 @@
+/// @file flip_engine_test.cpp
+/// @brief Apply batches of bistellar flips with the flip engine
+/// @author Adam Getchell
+/// @details Test functions defined in flip_engine.hpp
+/// @date 2026-10-16
+
+#include "flip_engine.hpp"
+
+#include <CGAL/Kernel/global_functions_3.h>
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+#include "random_triangulation.hpp"
+
+namespace {
+  /// Count pivot edges the slow way, by scanning every finite edge
+  auto count_pivot_edges(Delaunay const& triangulation) -> std::size_t
+  {
+    auto edges = get_finite_edges(triangulation);
+    return static_cast<std::size_t>(
+        std::count_if(edges.begin(), edges.end(), [&](auto const& edge) {
+          return get_octahedron_cells(triangulation, edge).has_value();
+        }));
+  }
+}  // namespace
+
+SCENARIO("Run batches of bistellar flips" *
+         doctest::test_suite("flip_engine"))
+{
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto        triangulation = make_random_triangulation(30, 42);
+    auto const  cells         = triangulation.number_of_cells();
+    Flip_engine engine(triangulation, 7);
+    REQUIRE_FALSE(engine.index().empty());
+    WHEN("The engine is run to a target number of flips")
+    {
+      Flip_engine_options options;
+      options.target_flips = 50;
+      auto report          = engine.run(options);
+      THEN("It stops at the target and accounts for every attempt")
+      {
+        CHECK_EQ(report.flips, 50);
+        auto const rejected = std::accumulate(report.rejections.begin(),
+                                              report.rejections.end(),
+                                              std::size_t{0});
+        CHECK_EQ(report.attempts, report.flips + rejected);
+        CHECK_EQ(report.rejected(Flip_status::SUCCESS), 0);
+        CHECK_EQ(report.cells_before, cells);
+        CHECK_EQ(report.cells_after, cells);
+        CHECK_GE(report.flips_per_second(), 0.0);
+      }
+      THEN("The triangulation and the index are still consistent")
+      {
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(engine.index().size(), count_pivot_edges(triangulation));
+      }
+    }
+    WHEN("The engine is run with no time budget")
+    {
+      Flip_engine_options options;
+      options.time_budget = std::chrono::nanoseconds::zero();
+      auto report         = engine.run(options);
+      THEN("No flips are attempted")
+      {
+        CHECK_EQ(report.attempts, 0);
+        CHECK_EQ(report.flips, 0);
+      }
+    }
+    WHEN("The engine is run with geometric validation")
+    {
+      Flip_engine_options options;
+      options.target_flips = 50;
+      options.validation   = Flip_validation::GEOMETRIC;
+      auto report          = engine.run(options);
+      THEN("No flip inverts a cell")
+      {
+        CHECK_GT(report.flips, 0);
+        CHECK(triangulation.tds().is_valid());
+        CHECK(std::ranges::all_of(
+            finite_cells_view(triangulation), [](auto const& cell) {
+              return CGAL::orientation(
+                         cell->vertex(0)->point(), cell->vertex(1)->point(),
+                         cell->vertex(2)->point(), cell->vertex(3)->point()) ==
+                     CGAL::POSITIVE;
+            }));
+      }
+    }
+    WHEN("Single steps are taken")
+    {
+      std::size_t flips = 0;
+      for (int i = 0; i < 20; ++i)
+      {
+        if (engine.step() == Flip_status::SUCCESS) { ++flips; }
+      }
+      THEN("Some succeed and the triangulation stays valid")
+      {
+        CHECK_GT(flips, 0);
+        CHECK(triangulation.tds().is_valid());
+      }
+    }
+  }
+}
@@ -0,0 +1,181 @@
+/// @file flip_journal_test.cpp
+/// @brief Undo bistellar flips and roll back to checkpoints
+/// @author Adam Getchell
+/// @details Test functions defined in flip_journal.hpp
+/// @date 2026-10-16
+
+#include "flip_journal.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "flip_engine.hpp"
+#include "pivot_edge_index.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// The vertices and neighbors of a cell, slot by slot
+  template <typename Triangulation>
+  struct Cell_state
+  {
+    std::array<Vertex_handle_t<Triangulation>, 4> vertices;
+    std::array<Cell_handle_t<Triangulation>, 4>   neighbors;
+    auto operator==(Cell_state const&) const -> bool = default;
+  };
+
+  /// Every cell of the triangulation, in container order
+  template <typename Triangulation>
+  auto snapshot(Triangulation const& triangulation)
+      -> std::vector<Cell_state<Triangulation>>
+  {
+    std::vector<Cell_state<Triangulation>> cells;
+    for (auto cell = triangulation.all_cells_begin();
+         cell != triangulation.all_cells_end(); ++cell)
+    {
+      Cell_state<Triangulation> state;
+      for (int i = 0; i < 4; ++i)
+      {
+        state.vertices[static_cast<std::size_t>(i)]  = cell->vertex(i);
+        state.neighbors[static_cast<std::size_t>(i)] = cell->neighbor(i);
+      }
+      cells.emplace_back(state);
+    }
+    return cells;
+  }
+
+  /// Flip random pivot edges through the journal
+  template <typename Triangulation>
+  auto flip_randomly(Triangulation&                     triangulation,
+                     Basic_flip_journal<Triangulation>& journal,
+                     std::size_t flips, std::uint64_t seed) -> std::size_t
+  {
+    Basic_pivot_edge_index<Triangulation> index(triangulation);
+    std::mt19937_64                       generator(seed);
+    std::size_t                           done = 0;
+    for (std::size_t attempt = 0; attempt < 100 * flips && done < flips;
+         ++attempt)
+    {
+      auto const edge = index.sample(generator);
+      if (!edge) { break; }
+      auto const cells = get_octahedron_cells(triangulation, *edge);
+      if (!cells) { continue; }
+      auto const top_and_bottom =
+          choose_top_and_bottom(*cells, *edge, generator);
+      if (!top_and_bottom) { continue; }
+      auto const key    = make_vertex_pair(*edge);
+      auto const result = journal.flip(triangulation, *edge,
+                                       top_and_bottom->first,
+                                       top_and_bottom->second);
+      index.update(triangulation, key, result);
+      if (result) { ++done; }
+    }
+    return done;
+  }
+}  // namespace
+
+SCENARIO("Undo a bistellar flip" * doctest::test_suite("flip_journal"))
+{
+  GIVEN("A triangulation and a flippable pivot edge")
+  {
+    auto          triangulation = make_random_triangulation(40, 5);
+    auto const    before        = snapshot(triangulation);
+    Flip_journal  journal;
+    REQUIRE_EQ(flip_randomly(triangulation, journal, 1, 9), 1);
+    REQUIRE_EQ(journal.size(), 1);
+    auto const record = journal.back();
+    WHEN("The flip is undone")
+    {
+      auto const result = journal.undo(triangulation);
+      THEN("Every cell is restored slot by slot")
+      {
+        CHECK(result);
+        CHECK(journal.empty());
+        CHECK(triangulation.is_valid());
+        CHECK_EQ(snapshot(triangulation), before);
+      }
+      THEN("The original pivot edge is returned")
+      {
+        auto const& [cell, first, second] = result.pivot_edge;
+        auto const endpoints = std::array{cell->vertex(first),
+                                          cell->vertex(second)};
+        CHECK(std::is_permutation(
+            endpoints.begin(), endpoints.end(),
+            std::array{record.plan.pivot_from_1, record.plan.pivot_from_2}
+                .begin()));
+      }
+    }
+  }
+}
+
+SCENARIO("Undo flips of a triangulation without cell info" *
+         doctest::test_suite("flip_journal"))
+{
+  GIVEN("A compact triangulation and flips recorded in its journal")
+  {
+    auto triangulation = make_random_triangulation<Compact_delaunay>(40, 6);
+    auto const                           before = snapshot(triangulation);
+    Basic_flip_journal<Compact_delaunay> journal;
+    auto const flips = flip_randomly(triangulation, journal, 5, 7);
+    REQUIRE_GT(flips, 0);
+    WHEN("The flips are rolled back")
+    {
+      auto const undone = journal.rollback(triangulation, 0);
+      THEN("Every cell is restored slot by slot")
+      {
+        CHECK_EQ(undone, flips);
+        CHECK(journal.empty());
+        CHECK(triangulation.is_valid());
+        CHECK_EQ(snapshot(triangulation), before);
+      }
+      THEN("The records kept no cell info")
+      {
+        CHECK(std::is_same_v<Cell_info_t<Compact_delaunay>, std::monostate>);
+      }
+    }
+  }
+}
+
+SCENARIO("Roll back a sequence of flips" *
+         doctest::test_suite("flip_journal"))
+{
+  GIVEN("A triangulation")
+  {
+    auto         triangulation = make_random_triangulation(60, 11);
+    auto const   original      = snapshot(triangulation);
+    Flip_journal journal;
+    WHEN("Flips are rolled back to checkpoints")
+    {
+      auto const first = flip_randomly(triangulation, journal, 10, 3);
+      REQUIRE_GT(first, 0);
+      auto const checkpoint = journal.checkpoint();
+      auto const middle     = snapshot(triangulation);
+      auto const second     = flip_randomly(triangulation, journal, 10, 4);
+      REQUIRE_GT(second, 0);
+      REQUIRE(triangulation.tds().is_valid());
+
+      THEN("Each checkpoint is restored exactly")
+      {
+        CHECK_EQ(journal.rollback(triangulation, checkpoint), second);
+        CHECK_EQ(snapshot(triangulation), middle);
+        CHECK_EQ(journal.rollback(triangulation, 0), first);
+        CHECK_EQ(snapshot(triangulation), original);
+        CHECK(triangulation.is_valid());
+        CHECK(journal.empty());
+      }
+      THEN("Committed flips are kept")
+      {
+        journal.commit();
+        CHECK(journal.empty());
+        CHECK_EQ(journal.rollback(triangulation, 0), 0);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_NE(snapshot(triangulation), original);
+      }
+    }
+  }
+}
@@ -27,6 +27,7 @@
 #include <boost/container/small_vector.hpp>
 #include <boost/container/vector.hpp>
 #include <boost/optional/optional.hpp>
+#include <algorithm>
 #include <iterator>
 #include <numbers>
 #include <optional>
@@ -34,16 +35,13 @@
 #include <vector>
 
 #include "bistellar_flip.hpp"
+#include "incident_cells_cache.hpp"
+#include "remeshing_adapter.hpp"
 
 static inline std::floating_point auto constexpr SQRT_2 =
     std::numbers::sqrt2_v<double>;
 static inline auto constexpr INV_SQRT_2 = 1.0 / SQRT_2;
 
-using CellsSmallVector = boost::container::small_vector<Cell_handle, 64>;
-using CellsSmallVectorOptional = boost::optional<CellsSmallVector>;
-using VertexIncidentCellsMap =
-    std::unordered_map<Vertex_handle, CellsSmallVectorOptional>;
-
 SCENARIO("Perform bistellar flip on Delaunay triangulation using CGAL " *
          doctest::test_suite("flip_n_to_m"))
 {
@@ -58,17 +56,26 @@ SCENARIO("Perform bistellar flip on Delaunay triangulation using CGAL " *
         Point{          0, -INV_SQRT_2, INV_SQRT_2},
         Point{          0,           0,          2}
     };
-    Delaunay triangulation(points.begin(), points.end());
+    // Built on the data structure remeshing uses, so that it can be lent to
+    // flip_n_to_m without a copy
+    Remeshable_delaunay triangulation(points.begin(), points.end());
     CHECK(triangulation.is_valid());
-    WHEN("We convert to a remeshing triangulation")
+    WHEN("We lend it to a remeshing triangulation")
     {
-      using Remeshing_triangulation =
-          CGAL::Tetrahedral_remeshing::Remeshing_triangulation_3<
-              CGAL::Exact_predicates_inexact_constructions_kernel>;
-      //      Remeshing_triangulation triangulation_2 =
-      //      CGAL::tetrahedron_soup_to_triangulation_3<Remeshing_triangulation>(triangulation);
-      Remeshing_triangulation remeshing_triangulation;
-      //      remeshing_triangulation.tds(). = triangulation;
+      auto const cells = triangulation.number_of_cells();
+      {
+        Remeshing_adapter adapter(triangulation);
+        THEN("The remeshing triangulation has its cells, and it has none")
+        {
+          CHECK_EQ(adapter.triangulation().number_of_cells(), cells);
+          CHECK_EQ(triangulation.number_of_vertices(), 0);
+        }
+      }
+      THEN("It gets its cells back afterwards")
+      {
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+        CHECK(triangulation.is_valid());
+      }
     }
     WHEN("We find the pivot edge in the triangulation")
     {
@@ -76,8 +83,9 @@ SCENARIO("Perform bistellar flip on Delaunay triangulation using CGAL " *
           find_pivot_edge(triangulation, get_finite_edges(triangulation));
       auto incident_cells =
           get_incident_cells(triangulation, pivot_edge.value());
-      auto                   vertices = get_vertices(incident_cells.value());
-      VertexIncidentCellsMap incident_cells_per_vertex;
+      auto vertices = get_vertices(incident_cells.value());
+      Incident_cells_cache<Remeshable_delaunay> incident_cells_per_vertex(
+          triangulation);
       THEN("We have a pivot edge")
       {
         REQUIRE_MESSAGE(pivot_edge, "Pivot edge not found");
@@ -97,29 +105,77 @@ SCENARIO("Perform bistellar flip on Delaunay triangulation using CGAL " *
       {
         for (auto const& vertex : get_vertices(incident_cells.value()))
         {
-          CellsSmallVector incident_cells_b;
-          // Put the incident cells into incident_cells
-          triangulation.tds().incident_cells(
-              vertex, std::back_inserter(incident_cells_b));
-          // Put the result into an option type
-          CellsSmallVectorOptional incident_cells_opt(incident_cells_b);
-          // Put the result into a map
-          incident_cells_per_vertex.emplace(vertex, incident_cells_opt);
+          // Gathered from the triangulation the first time only
+          CHECK_FALSE(incident_cells_per_vertex[vertex].empty());
+          CHECK_FALSE(incident_cells_per_vertex[vertex].empty());
         }
+        CHECK_EQ(incident_cells_per_vertex.misses(), 6);
         REQUIRE_EQ(incident_cells_per_vertex.size(), 6);
       }
-      THEN("We can call flip_n_to_m")
+    }
+    WHEN("We lend it to remeshing and call flip_n_to_m on the pivot edge")
+    {
+      using Remeshing_vertex_handle = Vertex_handle_t<Remeshable_delaunay>;
+      using Remeshing_cell_handle   = Cell_handle_t<Remeshable_delaunay>;
+      auto pivot_edge = find_pivot_edge(triangulation);
+      REQUIRE(pivot_edge);
+      auto const diagonals =
+          get_octahedron_diagonals(triangulation, *pivot_edge);
+      REQUIRE(diagonals);
+      auto const& [pivot, first, second] = *diagonals;
+      // The ring of vertices around the pivot edge, in order
+      std::vector<Remeshing_vertex_handle> ring{first.first, second.first,
+                                                first.second, second.second};
+      std::vector<Remeshing_vertex_handle> octahedron{pivot.first,
+                                                      pivot.second};
+      octahedron.insert(octahedron.end(), ring.begin(), ring.end());
       {
-        //                auto const result =
-        //                CGAL::Tetrahedral_remeshing::internal::flip_n_to_m(
-        //                    pivot_edge, triangulation, vertices,
-        //                    CGAL::Tetrahedral_remeshing::internal::MIN_ANGLE_BASED,
-        //                    incident_cells_per_vertex,
-        //                    CGAL::Tetrahedral_remeshing::internal::Default_remeshing_visitor());
-        //                CHECK_EQ(
-        //                    result,
-        //                    CGAL::Tetrahedral_remeshing::Sliver_removal_result::VALID_FLIP);
+        Remeshing_adapter              adapter(triangulation);
+        Remeshing_incident_cells_cache cache(adapter.triangulation());
+        for (auto const& vertex : octahedron)
+        {
+          static_cast<void>(cache[vertex]);
+        }
+
+        auto edge = *pivot_edge;
+        CGAL::Tetrahedral_remeshing::internal::Default_remeshing_visitor
+                   visitor;
+        auto const result = CGAL::Tetrahedral_remeshing::internal::flip_n_to_m(
+            edge, adapter.complex(), ring,
+            CGAL::Tetrahedral_remeshing::internal::MIN_ANGLE_BASED,
+            cache.map(), visitor);
+
+        // Any new cell has only vertices of the octahedron
+        std::vector<Remeshing_cell_handle> cells;
+        for (auto const& vertex : octahedron)
+        {
+          adapter.triangulation().tds().incident_cells(
+              vertex, std::back_inserter(cells));
+        }
+        cache.invalidate(cells);
+        THEN("The lent triangulation is valid and the flip removed the edge")
+        {
+          CHECK(adapter.triangulation().is_valid());
+          CHECK_EQ(
+              result ==
+                  CGAL::Tetrahedral_remeshing::Sliver_removal_result::VALID_FLIP,
+              !has_edge(pivot.first, pivot.second));
+        }
+        THEN("The invalidated cache matches the triangulation")
+        {
+          for (auto const& vertex : octahedron)
+          {
+            std::vector<Remeshing_cell_handle> expected;
+            adapter.triangulation().tds().incident_cells(
+                vertex, std::back_inserter(expected));
+            auto const& cached = cache[vertex];
+            CHECK_EQ(cached.size(), expected.size());
+            CHECK(std::is_permutation(cached.begin(), cached.end(),
+                                      expected.begin()));
+          }
+        }
       }
+      CHECK(triangulation.tds().is_valid());
     }
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,83 @@
+/// @file incident_cells_cache_test.cpp
+/// @brief Keep the incident cells of each vertex across flips
+/// @author Adam Getchell
+/// @details Test functions defined in incident_cells_cache.hpp
+/// @date 2026-10-16
+
+#include "incident_cells_cache.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "flip_engine.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// Whether the cache holds exactly the cells incident to a vertex
+  auto matches(Delaunay const& triangulation,
+               Incident_cells_cache<Delaunay>& cache,
+               Vertex_handle const&            vertex) -> bool
+  {
+    std::vector<Cell_handle> expected;
+    triangulation.tds().incident_cells(vertex, std::back_inserter(expected));
+    auto const& cached = cache[vertex];
+    return cached.size() == expected.size() &&
+           std::is_permutation(cached.begin(), cached.end(), expected.begin());
+  }
+}  // namespace
+
+SCENARIO("Cache the cells incident to each vertex" *
+         doctest::test_suite("incident_cells_cache"))
+{
+  GIVEN("A triangulation and an empty cache")
+  {
+    auto triangulation = make_random_triangulation(30, 4);
+    Incident_cells_cache<Delaunay> cache(triangulation);
+    auto const vertices = get_finite_vertices(triangulation);
+    WHEN("Every vertex is looked up twice")
+    {
+      for (auto const& vertex : vertices)
+      {
+        CHECK(matches(triangulation, cache, vertex));
+      }
+      for (auto const& vertex : vertices)
+      {
+        CHECK(matches(triangulation, cache, vertex));
+      }
+      THEN("The triangulation is only walked the first time")
+      {
+        CHECK_EQ(cache.size(), vertices.size());
+        CHECK_EQ(cache.misses(), vertices.size());
+      }
+    }
+    WHEN("The cells of a flip are invalidated")
+    {
+      for (auto const& vertex : vertices) { (void)cache[vertex]; }
+      auto const edge = find_pivot_edge(triangulation);
+      REQUIRE(edge);
+      auto const cells = get_octahedron_cells(triangulation, *edge);
+      REQUIRE(cells);
+      std::mt19937_64 generator(5);
+      auto const      top_and_bottom =
+          choose_top_and_bottom(*cells, *edge, generator);
+      REQUIRE(top_and_bottom);
+      auto const result = bistellar_flip(
+          triangulation, *edge, top_and_bottom->first, top_and_bottom->second);
+      REQUIRE(result);
+      cache.invalidate(result.cells);
+      THEN("Only the 6 vertices of the flip are gathered again")
+      {
+        for (auto const& vertex : vertices)
+        {
+          CHECK(matches(triangulation, cache, vertex));
+        }
+        CHECK_EQ(cache.misses(), vertices.size() + 6);
+      }
+    }
+  }
+}
@@ -0,0 +1,176 @@
+/// @file instrumentation_test.cpp
+/// @brief Stage timers and outcome counters for the flip pipeline
+/// @author Adam Getchell
+/// @details Test functions defined in instrumentation.hpp. Configure with
+/// -DENABLE_INSTRUMENTATION=ON to test the counters; otherwise these tests
+/// check that nothing is recorded.
+/// @date 2026-10-16
+
+#include "instrumentation.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "flip_engine.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// Try every choice of top and bottom vertices for each pivot edge until
+  /// one flip succeeds
+  /// @return The number of flips attempted
+  auto flip_once(Delaunay& triangulation) -> std::uint64_t
+  {
+    std::uint64_t attempts = 0;
+    for (auto const& edge : get_finite_edges(triangulation))
+    {
+      auto const cells = get_octahedron_cells(triangulation, edge);
+      if (!cells) { continue; }
+      auto const vertices = get_octahedron_vertices(*cells);
+      if (!vertices) { continue; }
+      for (auto const& top : *vertices)
+      {
+        for (auto const& bottom : *vertices)
+        {
+          ++attempts;
+          if (bistellar_flip(triangulation, edge, top, bottom))
+          {
+            return attempts;
+          }
+        }
+      }
+    }
+    return attempts;
+  }
+}  // namespace
+
+SCENARIO("Count the outcomes of flips" *
+         doctest::test_suite("instrumentation"))
+{
+  GIVEN("A triangulation and the current counters")
+  {
+    auto       triangulation = make_random_triangulation(40, 41);
+    auto const before        = instrumentation_snapshot();
+    WHEN("Flips are attempted until one succeeds")
+    {
+      auto const attempts = flip_once(triangulation);
+      REQUIRE_GT(attempts, 0);
+      auto const counts = instrumentation_snapshot() - before;
+      if constexpr (INSTRUMENTATION_ENABLED)
+      {
+        THEN("Every attempt is counted once, by outcome")
+        {
+          CHECK_EQ(counts.attempts(), attempts);
+          CHECK_EQ(counts.count(Flip_status::SUCCESS), 1);
+          CHECK_EQ(counts.count(Flip_status::WRONG_PIVOT_VERTEX_COUNT) +
+                       counts.count(Flip_status::PIVOT_EDGE_EXISTS) +
+                       counts.count(Flip_status::INVALID_CELL),
+                   attempts - 1);
+        }
+        THEN("Each stage is timed")
+        {
+          CHECK_EQ(counts.stage_calls[0], attempts);
+          CHECK_EQ(counts.stage_calls[static_cast<std::size_t>(
+                       Flip_stage::VALIDATION)],
+                   1);
+          CHECK_GT(counts.time(Flip_stage::INCIDENT_CELLS).count(), 0);
+        }
+      }
+      else
+      {
+        THEN("Nothing is recorded")
+        {
+          CHECK_EQ(counts.attempts(), 0);
+          CHECK_EQ(counts.time(Flip_stage::INCIDENT_CELLS).count(), 0);
+        }
+      }
+    }
+    WHEN("Every edge is flipped with top and bottom chosen automatically")
+    {
+      std::uint64_t calls = 0;
+      for (auto const& edge : get_finite_edges(triangulation))
+      {
+        ++calls;
+        static_cast<void>(
+            bistellar_flip(triangulation, edge, Flip_validation::GEOMETRIC));
+      }
+      auto const counts = instrumentation_snapshot() - before;
+      THEN("Each call is counted once, by the outcome it returned")
+      {
+        CHECK(triangulation.tds().is_valid());
+        if constexpr (INSTRUMENTATION_ENABLED)
+        {
+          CHECK_EQ(counts.attempts(), calls);
+        }
+        else { CHECK_EQ(counts.attempts(), 0); }
+      }
+    }
+    WHEN("A flip engine runs a batch")
+    {
+      Flip_engine         engine(triangulation, 42);
+      Flip_engine_options options;
+      options.target_flips = 30;
+      auto const report    = engine.run(options);
+      auto const counts    = instrumentation_snapshot() - before;
+      THEN("The counters agree with the report, rejection by rejection")
+      {
+        if constexpr (INSTRUMENTATION_ENABLED)
+        {
+          CHECK_EQ(counts.attempts(), report.attempts);
+          CHECK_EQ(counts.count(Flip_status::SUCCESS), report.flips);
+          for (std::size_t i = 0; i < report.rejections.size(); ++i)
+          {
+            if (i == static_cast<std::size_t>(Flip_status::SUCCESS))
+            {
+              continue;
+            }
+            CHECK_EQ(counts.outcomes[i], report.rejections[i]);
+          }
+        }
+        else { CHECK_EQ(counts.attempts(), 0); }
+      }
+    }
+  }
+}
+
+SCENARIO("Time stages and reset the counters" *
+         doctest::test_suite("instrumentation"))
+{
+  GIVEN("The process-wide counters")
+  {
+    auto& instrumentation = Flip_instrumentation::instance();
+    WHEN("A stage timer runs through every stage")
+    {
+      auto const before = instrumentation.snapshot();
+      {
+        Basic_stage_timer<true> timer(Flip_stage::INCIDENT_CELLS);
+        timer.next(Flip_stage::CLASSIFICATION);
+        timer.next(Flip_stage::CELL_CREATION);
+        timer.next(Flip_stage::NEIGHBOR_WIRING);
+        timer.next(Flip_stage::VALIDATION);
+      }
+      auto const counts = instrumentation.snapshot() - before;
+      THEN("Each stage is entered once")
+      {
+        for (auto const calls : counts.stage_calls) { CHECK_EQ(calls, 1); }
+      }
+    }
+    WHEN("The counters are reset")
+    {
+      instrumentation.record(Flip_status::INVALID_EDGE);
+      instrumentation.reset();
+      THEN("Every count is zero")
+      {
+        auto const counts = instrumentation.snapshot();
+        CHECK_EQ(counts.attempts(), 0);
+        for (auto const nanoseconds : counts.stage_nanoseconds)
+        {
+          CHECK_EQ(nanoseconds, 0);
+        }
+      }
+    }
+  }
+}
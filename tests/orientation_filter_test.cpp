@@ -0,0 +1,69 @@
+/// @file orientation_filter_test.cpp
+/// @brief Orientation of several tetrahedra at once with a static filter
+/// @author Adam Getchell
+/// @details Test functions defined in orientation_filter.hpp against
+/// CGAL::orientation()
+/// @date 2026-10-16
+
+#include "orientation_filter.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <random>
+
+#include "triangulation_config.hpp"
+
+using Tetrahedron = std::array<K::Point_3, 4>;
+
+SCENARIO("Orient a batch of tetrahedra" *
+         doctest::test_suite("orientation_filter"))
+{
+  GIVEN("Random tetrahedra")
+  {
+    std::mt19937_64                        generator(81);
+    std::uniform_real_distribution<double> coordinate(-1.0, 1.0);
+    auto const                             random_point = [&] {
+      auto const x = coordinate(generator);
+      auto const y = coordinate(generator);
+      return K::Point_3(x, y, coordinate(generator));
+    };
+    THEN("Every orientation matches the exact predicate")
+    {
+      for (int batch = 0; batch < 250; ++batch)
+      {
+        std::array<Tetrahedron, 4> tetrahedra;
+        for (auto& tetrahedron : tetrahedra)
+        {
+          for (auto& point : tetrahedron) { point = random_point(); }
+        }
+        auto const orientations = batch_orientation(tetrahedra);
+        for (std::size_t i = 0; i < tetrahedra.size(); ++i)
+        {
+          auto const& [p, q, r, s] = tetrahedra[i];
+          REQUIRE_EQ(orientations[i], CGAL::orientation(p, q, r, s));
+        }
+      }
+    }
+  }
+  GIVEN("Flat, nearly flat and axis-aligned tetrahedra")
+  {
+    K::Point_3 const           p(0, 0, 0);
+    K::Point_3 const           q(1, 0, 0);
+    K::Point_3 const           r(0, 1, 0);
+    std::array<Tetrahedron, 4> tetrahedra{
+        Tetrahedron{p, q, r, K::Point_3(0.3, 0.3, 0)},
+        Tetrahedron{p, q, r, K::Point_3(0.3, 0.3, 1e-9)},
+        Tetrahedron{p, q, r, K::Point_3(0.3, 0.3, -1e-9)},
+        Tetrahedron{p, q, r, K::Point_3(0, 0, 1)}
+    };
+    THEN("The ambiguous and out-of-range lanes fall back correctly")
+    {
+      auto const orientations = batch_orientation(tetrahedra);
+      CHECK_EQ(orientations[0], CGAL::ZERO);
+      CHECK_EQ(orientations[1], CGAL::POSITIVE);
+      CHECK_EQ(orientations[2], CGAL::NEGATIVE);
+      CHECK_EQ(orientations[3], CGAL::POSITIVE);
+    }
+  }
+}
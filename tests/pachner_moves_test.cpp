@@ -0,0 +1,307 @@
+/// @file pachner_moves_test.cpp
+/// @brief Apply and undo 1-4, 4-1, 2-3 and 3-2 moves
+/// @author Adam Getchell
+/// @details Test functions defined in pachner_moves.hpp
+/// @date 2026-10-16
+
+#include "pachner_moves.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "flip_engine.hpp"
+#include "pivot_edge_index.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  using Coordinates = std::array<double, 3>;
+
+  /// The finite cells as sorted point coordinates, independent of handles
+  auto snapshot(Delaunay const& triangulation)
+      -> std::vector<std::array<Coordinates, 4>>
+  {
+    std::vector<std::array<Coordinates, 4>> cells;
+    for (auto const& cell : finite_cells_view(triangulation))
+    {
+      std::array<Coordinates, 4> corners;
+      for (int i = 0; i < 4; ++i)
+      {
+        auto const& point = cell->vertex(i)->point();
+        corners[static_cast<std::size_t>(i)] = {point.x(), point.y(),
+                                                point.z()};
+      }
+      std::sort(corners.begin(), corners.end());
+      cells.emplace_back(corners);
+    }
+    std::sort(cells.begin(), cells.end());
+    return cells;
+  }
+
+  /// The number of cells incident to a vertex
+  auto degree(Delaunay const& triangulation, Vertex_handle const& vertex)
+      -> std::size_t
+  {
+    std::vector<Cell_handle> cells;
+    triangulation.incident_cells(vertex, std::back_inserter(cells));
+    return cells.size();
+  }
+
+  /// A facet shared by 2 finite cells whose opposite vertices are not
+  /// joined by an edge
+  auto find_two_three_facet(Delaunay const& triangulation)
+      -> std::pair<Cell_handle, int>
+  {
+    for (auto const& cell : finite_cells_view(triangulation))
+    {
+      for (int i = 0; i < 4; ++i)
+      {
+        auto const neighbor = cell->neighbor(i);
+        if (triangulation.is_infinite(neighbor)) { continue; }
+        if (!has_edge(cell->vertex(i), triangulation.mirror_vertex(cell, i)))
+        {
+          return {cell, i};
+        }
+      }
+    }
+    return {};
+  }
+}  // namespace
+
+SCENARIO("Insert and remove a vertex with 1-4 and 4-1 moves" *
+         doctest::test_suite("pachner_moves"))
+{
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto       triangulation = make_random_triangulation(30, 1);
+    auto const before        = snapshot(triangulation);
+    auto const vertices      = triangulation.number_of_vertices();
+    auto const cells         = triangulation.number_of_cells();
+    WHEN("A vertex is inserted at the centroid of a cell")
+    {
+      auto const cell   = *finite_cells_view(triangulation).begin();
+      auto const result = one_four_move(triangulation, cell);
+      THEN("The cell is split into 4 around a vertex of degree 4")
+      {
+        REQUIRE(result);
+        CHECK_EQ(result.cells.size(), 4);
+        CHECK_EQ(result.cells.front(), cell);
+        CHECK_EQ(triangulation.number_of_vertices(), vertices + 1);
+        CHECK_EQ(triangulation.number_of_cells(), cells + 3);
+        CHECK_EQ(degree(triangulation, result.vertex), 4);
+        CHECK(triangulation.tds().is_valid());
+      }
+      THEN("Removing the vertex restores the triangulation")
+      {
+        REQUIRE(result);
+        auto const removed = four_one_move(triangulation, result.vertex);
+        REQUIRE(removed);
+        CHECK_EQ(removed.cells.size(), 1);
+        CHECK_EQ(triangulation.number_of_vertices(), vertices);
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(snapshot(triangulation), before);
+      }
+    }
+    WHEN("A vertex of higher degree is removed")
+    {
+      auto const finite_vertices = finite_vertices_view(triangulation);
+      auto const vertex =
+          std::ranges::find_if(finite_vertices, [&](auto const& candidate) {
+            return degree(triangulation, candidate) > 4;
+          });
+      REQUIRE(vertex != finite_vertices.end());
+      auto const result = four_one_move(triangulation, *vertex);
+      THEN("The move is rejected and nothing changes")
+      {
+        CHECK_EQ(result.status, Flip_status::WRONG_VALENCE);
+        CHECK_EQ(snapshot(triangulation), before);
+      }
+    }
+  }
+}
+
+SCENARIO("Exchange a facet and an edge with 2-3 and 3-2 moves" *
+         doctest::test_suite("pachner_moves"))
+{
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto       triangulation = make_random_triangulation(30, 2);
+    auto const before        = snapshot(triangulation);
+    auto const cells         = triangulation.number_of_cells();
+    auto const [cell, facet] = find_two_three_facet(triangulation);
+    REQUIRE(cell != Cell_handle{});
+    WHEN("A 2-3 move is applied")
+    {
+      auto const top    = cell->vertex(facet);
+      auto const bottom = triangulation.mirror_vertex(cell, facet);
+      auto const result = two_three_move(triangulation, cell, facet);
+      THEN("The 2 cells become 3 around a new edge")
+      {
+        REQUIRE(result);
+        CHECK_EQ(result.cells.size(), 3);
+        CHECK_EQ(triangulation.number_of_cells(), cells + 1);
+        CHECK(has_edge(top, bottom));
+        CHECK(std::ranges::all_of(result.cells, [&](auto const& new_cell) {
+          return new_cell->has_vertex(top) && new_cell->has_vertex(bottom);
+        }));
+        CHECK(triangulation.tds().is_valid());
+      }
+      THEN("A 3-2 move on the new edge restores the triangulation")
+      {
+        REQUIRE(result);
+        auto const& first = result.cells.front();
+        auto const  undone = three_two_move(
+            triangulation,
+            Edge_handle{first, first->index(top), first->index(bottom)});
+        REQUIRE(undone);
+        CHECK_EQ(undone.cells.size(), 2);
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(snapshot(triangulation), before);
+      }
+    }
+    WHEN("A 3-2 move is applied to a pivot edge")
+    {
+      auto const edge   = find_pivot_edge(triangulation);
+      REQUIRE(edge);
+      auto const result = three_two_move(triangulation, *edge);
+      THEN("It is rejected")
+      {
+        CHECK_EQ(result.status, Flip_status::WRONG_VALENCE);
+        CHECK_EQ(snapshot(triangulation), before);
+      }
+    }
+  }
+}
+
+SCENARIO("Roll back a mix of moves" * doctest::test_suite("pachner_moves"))
+{
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto         triangulation = make_random_triangulation(30, 3);
+    auto const   before        = snapshot(triangulation);
+    auto const   vertices      = triangulation.number_of_vertices();
+    Move_journal journal;
+    WHEN("Random moves are applied through the journal")
+    {
+      std::mt19937_64                            generator(8);
+      std::uniform_int_distribution<std::size_t> choose_move(0, 4);
+      std::vector<Vertex_handle>                 inserted;
+      std::size_t                                checkpoint = 0;
+      for (std::size_t step = 0; step < 60; ++step)
+      {
+        if (step == 30) { checkpoint = journal.checkpoint(); }
+        auto const cells = get_finite_cells(triangulation);
+        std::uniform_int_distribution<std::size_t> choose_cell(
+            0, cells.size() - 1);
+        auto const cell = cells[choose_cell(generator)];
+        switch (choose_move(generator))
+        {
+          case 0:
+          {
+            auto result = journal.one_four(
+                triangulation, cell,
+                CGAL::centroid(cell->vertex(0)->point(),
+                               cell->vertex(1)->point(),
+                               cell->vertex(2)->point(),
+                               cell->vertex(3)->point()));
+            if (result) { inserted.emplace_back(result.vertex); }
+            break;
+          }
+          case 1:
+            if (!inserted.empty())
+            {
+              journal.four_one(triangulation, inserted.back());
+              inserted.pop_back();
+            }
+            break;
+          case 2:
+            journal.two_three(triangulation, cell,
+                                    static_cast<int>(step % 4));
+            break;
+          case 3:
+          {
+            auto const edges = get_finite_edges(triangulation);
+            auto const edge  = std::ranges::find_if(edges, [&](auto const& e) {
+              return count_finite_incident_cells(triangulation, e) == 3;
+            });
+            if (edge != edges.end())
+            {
+              journal.three_two(triangulation, *edge);
+            }
+            break;
+          }
+          default:
+          {
+            auto const edge = find_pivot_edge(triangulation);
+            if (!edge) { break; }
+            auto const octahedron = get_octahedron_cells(triangulation, *edge);
+            if (!octahedron) { break; }
+            auto const top_and_bottom =
+                choose_top_and_bottom(*octahedron, *edge, generator);
+            if (!top_and_bottom) { break; }
+            journal.four_four(triangulation, *edge,
+                                    top_and_bottom->first,
+                                    top_and_bottom->second);
+          }
+        }
+      }
+      REQUIRE(triangulation.tds().is_valid());
+      REQUIRE_GT(journal.size(), checkpoint);
+      REQUIRE_GT(checkpoint, 0);
+      THEN("Rolling back restores the triangulation")
+      {
+        journal.rollback(triangulation, checkpoint);
+        CHECK_EQ(journal.size(), checkpoint);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(journal.rollback(triangulation, 0), checkpoint);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(triangulation.number_of_vertices(), vertices);
+        CHECK_EQ(snapshot(triangulation), before);
+      }
+    }
+  }
+}
+
+SCENARIO("A move that can no longer be undone stays recorded" *
+         doctest::test_suite("pachner_moves"))
+{
+  GIVEN("A vertex inserted through the journal")
+  {
+    auto         triangulation = make_random_triangulation(30, 5);
+    Move_journal journal;
+    auto const   cell     = get_finite_cells(triangulation).front();
+    auto const   inserted = journal.one_four(
+        triangulation, cell,
+        CGAL::centroid(cell->vertex(0)->point(), cell->vertex(1)->point(),
+                       cell->vertex(2)->point(), cell->vertex(3)->point()));
+    REQUIRE(inserted);
+    WHEN("A move outside the journal raises its degree above 4")
+    {
+      auto const other = one_four_move(triangulation, inserted.cells.front());
+      REQUIRE(other);
+      THEN("Undoing is rejected and the journal is unchanged")
+      {
+        auto const cells = triangulation.number_of_cells();
+        CHECK_FALSE(journal.undo(triangulation));
+        CHECK_EQ(journal.size(), 1);
+        CHECK_EQ(journal.rollback(triangulation, 0), 0);
+        CHECK_EQ(journal.size(), 1);
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+        CHECK(triangulation.tds().is_valid());
+      }
+      THEN("Undoing succeeds once that move is undone")
+      {
+        REQUIRE(four_one_move(triangulation, other.vertex));
+        CHECK(journal.undo(triangulation));
+        CHECK(journal.empty());
+        CHECK(triangulation.tds().is_valid());
+      }
+    }
+  }
+}
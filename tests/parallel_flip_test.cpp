@@ -0,0 +1,137 @@
+/// @file parallel_flip_test.cpp
+/// @brief Apply independent bistellar flips concurrently
+/// @author Adam Getchell
+/// @details Test functions defined in parallel_flip.hpp
+/// @date 2026-10-16
+
+#include "parallel_flip.hpp"
+
+#include <CGAL/Kernel/global_functions_3.h>
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "random_triangulation.hpp"
+
+namespace {
+  /// Count pivot edges the slow way, by scanning every finite edge
+  auto count_pivot_edges(Delaunay const& triangulation) -> std::size_t
+  {
+    auto edges = get_finite_edges(triangulation);
+    return static_cast<std::size_t>(
+        std::count_if(edges.begin(), edges.end(), [&](auto const& edge) {
+          return get_octahedron_cells(triangulation, edge).has_value();
+        }));
+  }
+}  // namespace
+
+SCENARIO("Select independent flips" * doctest::test_suite("parallel_flip"))
+{
+  GIVEN("Plans for every pivot edge of a random triangulation")
+  {
+    auto             triangulation = make_random_triangulation(60, 11);
+    Pivot_edge_index index(triangulation);
+    std::mt19937_64  generator(3);
+    std::vector<Flip_plan> plans;
+    for (std::size_t i = 0; i < index.size(); ++i)
+    {
+      auto cells = get_octahedron_cells(triangulation, index[i]);
+      if (!cells) { continue; }
+      auto top_and_bottom = choose_top_and_bottom(*cells, index[i], generator);
+      if (!top_and_bottom) { continue; }
+      plans.emplace_back(plan_flip(triangulation, index[i],
+                                   top_and_bottom->first,
+                                   top_and_bottom->second));
+    }
+    REQUIRE_FALSE(plans.empty());
+    WHEN("Independent flips are selected")
+    {
+      auto selected = select_independent_flips(plans);
+      THEN("They are successful plans that share no vertex")
+      {
+        REQUIRE_FALSE(selected.empty());
+        std::unordered_set<Vertex_handle> seen;
+        for (auto const i : selected)
+        {
+          CHECK(plans[i]);
+          for (auto const& vertex : plans[i].vertices())
+          {
+            CHECK(seen.insert(vertex).second);
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Run rounds of parallel bistellar flips" *
+         doctest::test_suite("parallel_flip"))
+{
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto                 triangulation = make_random_triangulation(80, 42);
+    auto const           cells         = triangulation.number_of_cells();
+    Parallel_flip_engine engine(triangulation, 7);
+    REQUIRE_FALSE(engine.index().empty());
+    WHEN("The engine is run to a target number of flips")
+    {
+      Flip_engine_options options;
+      options.target_flips = 50;
+      options.batch_size   = 16;
+      auto report          = engine.run(options);
+      THEN("It stops at the target and accounts for every attempt")
+      {
+        CHECK_EQ(report.flips, 50);
+        auto const rejected = std::accumulate(report.rejections.begin(),
+                                              report.rejections.end(),
+                                              std::size_t{0});
+        CHECK_EQ(report.attempts, report.flips + rejected);
+        CHECK_EQ(report.cells_after, cells);
+      }
+      THEN("The triangulation and the index are still consistent")
+      {
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(engine.index().size(), count_pivot_edges(triangulation));
+      }
+    }
+    WHEN("The engine is run with global validation")
+    {
+      Flip_engine_options options;
+      options.target_flips = 20;
+      options.batch_size   = 16;
+      options.validation   = Flip_validation::GLOBAL;
+      auto report          = engine.run(options);
+      THEN("The whole triangulation is checked after each round")
+      {
+        CHECK_EQ(report.flips, 20);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(engine.index().size(), count_pivot_edges(triangulation));
+      }
+    }
+    WHEN("The engine is run with geometric validation")
+    {
+      Flip_engine_options options;
+      options.target_flips = 50;
+      options.batch_size   = 16;
+      options.validation   = Flip_validation::GEOMETRIC;
+      auto report          = engine.run(options);
+      THEN("No flip inverts a cell")
+      {
+        CHECK_GT(report.flips, 0);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(engine.index().size(), count_pivot_edges(triangulation));
+        CHECK(std::ranges::all_of(
+            finite_cells_view(triangulation), [](auto const& cell) {
+              return CGAL::orientation(
+                         cell->vertex(0)->point(), cell->vertex(1)->point(),
+                         cell->vertex(2)->point(), cell->vertex(3)->point()) ==
+                     CGAL::POSITIVE;
+            }));
+      }
+    }
+  }
+}
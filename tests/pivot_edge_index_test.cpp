@@ -0,0 +1,196 @@
+/// @file pivot_edge_index_test.cpp
+/// @brief Maintain the index of pivot edges across bistellar flips
+/// @author Adam Getchell
+/// @details Test functions defined in pivot_edge_index.hpp
+/// @date 2026-10-16
+
+#include "pivot_edge_index.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <numbers>
+#include <random>
+#include <vector>
+
+#include "random_triangulation.hpp"
+
+static inline std::floating_point auto constexpr SQRT_2 =
+    std::numbers::sqrt2_v<double>;
+static inline auto constexpr INV_SQRT_2 = 1.0 / SQRT_2;
+
+namespace {
+  /// Count pivot edges the slow way, by scanning every finite edge
+  auto count_pivot_edges(Delaunay const& triangulation) -> std::size_t
+  {
+    auto edges = get_finite_edges(triangulation);
+    return static_cast<std::size_t>(
+        std::count_if(edges.begin(), edges.end(), [&](auto const& edge) {
+          return get_octahedron_cells(triangulation, edge).has_value();
+        }));
+  }
+
+  /// Flip an edge, trying each choice of top and bottom vertices
+  auto flip_any(Delaunay& triangulation, Edge_handle const& edge)
+      -> Flip_result
+  {
+    auto incident_cells = get_incident_cells(triangulation, edge);
+    auto vertices       = get_vertices(incident_cells.value());
+    for (auto const& top : vertices)
+    {
+      for (auto const& bottom : vertices)
+      {
+        if (auto result = bistellar_flip(triangulation, edge, top, bottom))
+        {
+          return result;
+        }
+      }
+    }
+    return Flip_result{};
+  }
+}  // namespace
+
+SCENARIO("Index the pivot edges of a triangulation" *
+         doctest::test_suite("pivot_edge_index"))
+{
+  GIVEN("A valid Delaunay triangulation")
+  {
+    std::vector<Point> points{
+        Point{          0,           0,          0},
+        Point{ INV_SQRT_2,           0, INV_SQRT_2},
+        Point{          0,  INV_SQRT_2,          0},
+        Point{-INV_SQRT_2,           0, INV_SQRT_2},
+        Point{          0, -INV_SQRT_2, INV_SQRT_2},
+        Point{          0,           0,          2}
+    };
+    Delaunay         triangulation(points.begin(), points.end());
+    Pivot_edge_index index(triangulation);
+    WHEN("The index is built")
+    {
+      THEN("It holds the same edges as find_pivot_edge")
+      {
+        REQUIRE_EQ(index.size(), count_pivot_edges(triangulation));
+        auto pivot_edge =
+            find_pivot_edge(triangulation, get_finite_edges(triangulation));
+        REQUIRE(pivot_edge);
+        auto const [first, second] = make_vertex_pair(pivot_edge.value());
+        CHECK(index.contains(first, second));
+        CHECK(index.contains(second, first));
+      }
+      THEN("A sampled edge has 4 incident finite cells")
+      {
+        std::mt19937_64 generator(1);
+        auto            edge = index.sample(generator);
+        REQUIRE(edge);
+        CHECK_EQ(count_finite_incident_cells(triangulation, edge.value()), 4);
+      }
+    }
+    WHEN("A pivot edge is flipped and the index updated")
+    {
+      std::mt19937_64 generator(1);
+      auto            edge      = index.sample(generator).value();
+      auto            old_pivot = make_vertex_pair(edge);
+      auto            result    = flip_any(triangulation, edge);
+      REQUIRE(result);
+      index.update(triangulation, old_pivot, result);
+      THEN("The old pivot edge is gone and the new one is indexed")
+      {
+        CHECK_FALSE(index.contains(old_pivot.first, old_pivot.second));
+        auto const [first, second] = make_vertex_pair(result.pivot_edge);
+        CHECK(index.contains(first, second));
+        CHECK_EQ(index.size(), count_pivot_edges(triangulation));
+      }
+    }
+  }
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto             triangulation = make_random_triangulation(30, 42);
+    Pivot_edge_index index(triangulation);
+    std::mt19937_64  generator(42);
+    REQUIRE_EQ(index.size(), count_pivot_edges(triangulation));
+    WHEN("The edges on the hull with 4 finite cells are looked up")
+    {
+      int indexed = 0;
+      for (auto const& edge : finite_edges_view(triangulation))
+      {
+        if (count_finite_incident_cells(triangulation, edge) != 4 ||
+            get_octahedron_cells(triangulation, edge))
+        {
+          continue;
+        }
+        auto const [first, second] = make_vertex_pair(edge);
+        if (index.contains(first, second)) { ++indexed; }
+      }
+      THEN("None of them is indexed, since they cannot be flipped")
+      {
+        CHECK_EQ(indexed, 0);
+      }
+    }
+    WHEN("A sequence of sampled edges is flipped")
+    {
+      int flips = 0;
+      for (int attempt = 0; attempt < 20; ++attempt)
+      {
+        auto edge = index.sample(generator);
+        REQUIRE(edge);
+        auto old_pivot = make_vertex_pair(edge.value());
+        auto result    = flip_any(triangulation, edge.value());
+        if (result) { ++flips; }
+        index.update(triangulation, old_pivot, result);
+      }
+      THEN("The index matches a full rescan")
+      {
+        CHECK_GT(flips, 0);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(index.size(), count_pivot_edges(triangulation));
+        for (std::size_t i = 0; i < index.size(); ++i)
+        {
+          CHECK(get_octahedron_cells(triangulation, index[i]));
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Predict the change in pivot edges from a plan" *
+         doctest::test_suite("pivot_edge_index"))
+{
+  GIVEN("A Delaunay triangulation of random points")
+  {
+    auto             triangulation = make_random_triangulation(40, 43);
+    Pivot_edge_index index(triangulation);
+    std::mt19937_64  generator(43);
+    WHEN("Sampled edges are planned and flipped")
+    {
+      int flips      = 0;
+      int mispredict = 0;
+      for (int attempt = 0; attempt < 20; ++attempt)
+      {
+        auto edge = index.sample(generator);
+        REQUIRE(edge);
+        for (auto const& plan : plan_flips(triangulation, edge.value()))
+        {
+          if (!plan) { continue; }
+          auto const old_pivot = make_vertex_pair(edge.value());
+          auto const change    = pivot_edge_change(triangulation, plan);
+          auto const before    = static_cast<int>(index.size());
+          auto const result    = apply_flip(triangulation, plan);
+          REQUIRE(result);
+          index.update(triangulation, old_pivot, result);
+          ++flips;
+          if (static_cast<int>(index.size()) != before + change)
+          {
+            ++mispredict;
+          }
+          break;
+        }
+      }
+      THEN("The index changes by the predicted amount with each flip")
+      {
+        CHECK_GT(flips, 0);
+        CHECK_EQ(mispredict, 0);
+        CHECK_EQ(index.size(), count_pivot_edges(triangulation));
+      }
+    }
+  }
+}
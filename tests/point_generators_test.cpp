@@ -0,0 +1,125 @@
+/// @file point_generators_test.cpp
+/// @brief Reproducible random point sets and their Delaunay triangulations
+/// @author Adam Getchell
+/// @details Test functions defined in point_generators.hpp
+/// @date 2026-10-16
+
+#include "point_generators.hpp"
+
+#include <doctest/doctest.h>
+#include <tbb/global_control.h>
+
+#include <cmath>
+#include <vector>
+
+namespace {
+  /// @return The distance of a point from the origin
+  auto norm(Point const& point) -> double
+  {
+    return std::sqrt(point.x() * point.x() + point.y() * point.y() +
+                     point.z() * point.z());
+  }
+
+  /// The number of points, spanning several blocks
+  inline constexpr std::size_t POINTS = 3 * POINT_BLOCK_SIZE + 17;
+}  // namespace
+
+SCENARIO("Generate reproducible point sets" *
+         doctest::test_suite("point_generators"))
+{
+  GIVEN("Every point distribution")
+  {
+    for (auto const distribution :
+         {Point_distribution::CUBE, Point_distribution::BALL,
+          Point_distribution::SHELL, Point_distribution::LATTICE})
+    {
+      CAPTURE(to_string(distribution));
+      auto const points = generate_points(distribution, POINTS, 61);
+      REQUIRE_EQ(points.size(), POINTS);
+      THEN("Its name is parsed back")
+      {
+        CHECK_EQ(parse_point_distribution(to_string(distribution)),
+                 distribution);
+      }
+      THEN("The same seed gives the same points on one thread")
+      {
+        tbb::global_control const one_thread(
+            tbb::global_control::max_allowed_parallelism, 1);
+        CHECK_EQ(generate_points(distribution, POINTS, 61), points);
+      }
+      THEN("Another seed gives other points")
+      {
+        CHECK_NE(generate_points(distribution, POINTS, 62), points);
+      }
+      THEN("Every point lies in the shape")
+      {
+        for (auto const& point : points)
+        {
+          switch (distribution)
+          {
+            case Point_distribution::CUBE:
+            case Point_distribution::LATTICE:
+              REQUIRE(point.x() >= 0.0);
+              REQUIRE(point.x() < 1.0);
+              REQUIRE(point.y() >= 0.0);
+              REQUIRE(point.y() < 1.0);
+              REQUIRE(point.z() >= 0.0);
+              REQUIRE(point.z() < 1.0);
+              break;
+            case Point_distribution::BALL: REQUIRE(norm(point) < 1.0); break;
+            case Point_distribution::SHELL:
+              REQUIRE(norm(point) >= SHELL_INNER_RADIUS - 1e-12);
+              REQUIRE(norm(point) < 1.0);
+              break;
+          }
+        }
+      }
+    }
+  }
+  GIVEN("An unknown name")
+  {
+    THEN("It is not parsed")
+    {
+      CHECK_FALSE(parse_point_distribution("torus"));
+    }
+  }
+}
+
+SCENARIO("Triangulate generated point sets" *
+         doctest::test_suite("point_generators"))
+{
+  GIVEN("A point set")
+  {
+    auto points = generate_points(Point_distribution::BALL, 60, 63);
+    WHEN("It is triangulated by hinted insertion in spatial order")
+    {
+      Delaunay const expected(points.begin(), points.end());
+      auto const     triangulation = make_delaunay(points);
+      THEN("The triangulation is the Delaunay triangulation of the points")
+      {
+        CHECK(triangulation.is_valid());
+        CHECK_EQ(triangulation.number_of_vertices(), 60);
+        CHECK_EQ(triangulation.number_of_finite_cells(),
+                 expected.number_of_finite_cells());
+        CHECK_EQ(triangulation.number_of_finite_edges(),
+                 expected.number_of_finite_edges());
+      }
+    }
+  }
+  GIVEN("A seed")
+  {
+    WHEN("A jittered lattice is triangulated twice")
+    {
+      auto const first = make_random_delaunay<Compact_delaunay>(
+          Point_distribution::LATTICE, 64, 64);
+      auto const second = make_random_delaunay<Compact_delaunay>(
+          Point_distribution::LATTICE, 64, 64);
+      THEN("Both triangulations are valid and the same size")
+      {
+        CHECK(first.is_valid());
+        CHECK_EQ(first.number_of_vertices(), 64);
+        CHECK_EQ(first.number_of_cells(), second.number_of_cells());
+      }
+    }
+  }
+}
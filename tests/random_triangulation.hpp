@@ -0,0 +1,38 @@
+/// @file random_triangulation.hpp
+/// @brief Random triangulations shared by the tests
+/// @author Adam Getchell
+/// @details Tests that need a triangulation of many points build it here,
+/// so the same seed gives the same points in every test file.
+/// @date Created: 2026-10-16
+
+#ifndef BISTELLAR_FLIP_TESTS_RANDOM_TRIANGULATION_HPP
+#define BISTELLAR_FLIP_TESTS_RANDOM_TRIANGULATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+
+/// @brief A triangulation of random points in the unit cube
+/// @tparam Triangulation The type of triangulation to build
+/// @param number_of_points The number of points
+/// @param seed Seed of the point coordinates
+/// @return The Delaunay triangulation of the points
+template <typename Triangulation = Delaunay>
+auto make_random_triangulation(std::size_t   number_of_points,
+                               std::uint64_t seed) -> Triangulation
+{
+  std::mt19937_64                            generator(seed);
+  std::uniform_real_distribution<double>     coordinate(0.0, 1.0);
+  std::vector<typename Triangulation::Point> points;
+  for (std::size_t i = 0; i < number_of_points; ++i)
+  {
+    points.emplace_back(coordinate(generator), coordinate(generator),
+                        coordinate(generator));
+  }
+  return Triangulation(points.begin(), points.end());
+}  // make_random_triangulation()
+
+#endif  // BISTELLAR_FLIP_TESTS_RANDOM_TRIANGULATION_HPP
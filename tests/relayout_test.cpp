@@ -0,0 +1,123 @@
+/// @file relayout_test.cpp
+/// @brief Reorder vertex and cell storage along a Hilbert curve
+/// @author Adam Getchell
+/// @details Test functions defined in relayout.hpp and the re-layout
+/// interval of Flip_engine
+/// @date 2026-10-16
+
+#include "relayout.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "flip_engine.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// A Delaunay triangulation of random points in the unit cube, with each
+  /// vertex numbered in its info
+  auto make_numbered_triangulation(std::size_t   number_of_points,
+                                   std::uint64_t seed) -> Delaunay
+  {
+    auto triangulation = make_random_triangulation(number_of_points, seed);
+    int  id            = 0;
+    for (auto const& vertex : finite_vertices_view(triangulation))
+    {
+      vertex->info() = id++;
+    }
+    return triangulation;
+  }
+
+  /// The finite cells as sorted vertex numbers, independent of storage
+  auto cells_by_info(Delaunay const& triangulation)
+      -> std::set<std::array<int, 4>>
+  {
+    std::set<std::array<int, 4>> cells;
+    for (auto const& cell : finite_cells_view(triangulation))
+    {
+      std::array<int, 4> ids{};
+      for (int i = 0; i < 4; ++i)
+      {
+        ids[static_cast<std::size_t>(i)] = cell->vertex(i)->info();
+      }
+      std::sort(ids.begin(), ids.end());
+      cells.insert(ids);
+    }
+    return cells;
+  }
+}  // namespace
+
+SCENARIO("Reorder a triangulation along a Hilbert curve" *
+         doctest::test_suite("relayout"))
+{
+  GIVEN("A triangulation that has been flipped")
+  {
+    auto                triangulation = make_numbered_triangulation(60, 71);
+    Flip_engine         engine(triangulation, 72);
+    Flip_engine_options options;
+    options.target_flips = 50;
+    REQUIRE_GT(engine.run(options).flips, 0);
+    auto const cells        = cells_by_info(triangulation);
+    auto const vertex_count = triangulation.number_of_vertices();
+    auto const cell_count   = triangulation.number_of_cells();
+    WHEN("Its storage is reordered")
+    {
+      std::vector<Point> points;
+      for (auto const& vertex : finite_vertices_view(triangulation))
+      {
+        points.emplace_back(vertex->point());
+      }
+      auto const order = hilbert_order<K>(points);
+      REQUIRE(relayout(triangulation));
+      THEN("It is the same triangulation")
+      {
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(triangulation.number_of_vertices(), vertex_count);
+        CHECK_EQ(triangulation.number_of_cells(), cell_count);
+        CHECK_EQ(cells_by_info(triangulation), cells);
+      }
+      THEN("The vertices are stored in Hilbert order")
+      {
+        std::size_t position = 0;
+        for (auto const& vertex : finite_vertices_view(triangulation))
+        {
+          REQUIRE_EQ(vertex->point(), points[order[position++]]);
+        }
+      }
+    }
+  }
+  GIVEN("An empty triangulation")
+  {
+    Delaunay triangulation;
+    THEN("It is left alone") { CHECK_FALSE(relayout(triangulation)); }
+  }
+}
+
+SCENARIO("Reorder storage between flips" * doctest::test_suite("relayout"))
+{
+  GIVEN("A flip engine with a re-layout interval")
+  {
+    auto                triangulation = make_numbered_triangulation(60, 73);
+    Flip_engine         engine(triangulation, 74);
+    Flip_engine_options options;
+    options.target_flips      = 40;
+    options.relayout_interval = 10;
+    WHEN("It runs")
+    {
+      auto const report = engine.run(options);
+      THEN("Storage is reordered at every interval and flips continue")
+      {
+        REQUIRE_EQ(report.flips, 40);
+        CHECK_EQ(report.relayouts, 4);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(engine.index().size(),
+                 Pivot_edge_index(triangulation).size());
+      }
+    }
+  }
+}
@@ -0,0 +1,167 @@
+/// @file replica_runner_test.cpp
+/// @brief Flip many triangulations at different couplings in one process
+/// @author Adam Getchell
+/// @details Test functions defined in replica_runner.hpp
+/// @date 2026-10-16
+
+#include "replica_runner.hpp"
+
+#include <doctest/doctest.h>
+
+#include <array>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "soa_snapshot.hpp"
+
+namespace {
+  /// An action penalizing uneven vertex degrees
+  auto degree_action(Star_sums const& sums) -> double
+  {
+    return static_cast<double>(sums.degree_squares);
+  }
+
+  /// The same action counted from scratch on a triangulation
+  auto count_degree_action(Delaunay const& triangulation) -> double
+  {
+    auto const degrees = vertex_degrees(make_soa_snapshot(triangulation));
+    double     energy  = 0.0;
+    for (std::size_t i = 1; i < degrees.size(); ++i)
+    {
+      energy += static_cast<double>(degrees[i]) * degrees[i];
+    }
+    return energy;
+  }
+}  // namespace
+
+SCENARIO("Build replicas at several couplings" *
+         doctest::test_suite("replica_runner"))
+{
+  GIVEN("A runner with 4 couplings")
+  {
+    Replica_runner const runner({0.0, 0.1, 0.2, 0.3}, Point_distribution::BALL,
+                                40, 91);
+    THEN("Each replica is its own valid triangulation at its own coupling")
+    {
+      REQUIRE_EQ(runner.size(), 4);
+      std::set<double> first_coordinates;
+      for (std::size_t i = 0; i < runner.size(); ++i)
+      {
+        auto const& replica = runner.replica(i);
+        CHECK(replica.triangulation.tds().is_valid());
+        CHECK_EQ(replica.triangulation.number_of_vertices(), 40);
+        CHECK_EQ(replica.parameter, i);
+        CHECK_EQ(&runner.replica_at(i), &replica);
+        first_coordinates.insert(
+            replica.triangulation.finite_vertices_begin()->point().x());
+      }
+      CHECK_EQ(first_coordinates.size(), 4);
+    }
+  }
+}
+
+SCENARIO("Run replicas concurrently with exchanges" *
+         doctest::test_suite("replica_runner"))
+{
+  GIVEN("A runner whose replicas all share one coupling")
+  {
+    Replica_runner runner({0.5, 0.5, 0.5, 0.5}, Point_distribution::CUBE, 40,
+                          92);
+
+    Replica_runner_options options;
+    options.sweep.target_flips = 10;
+    options.sweeps             = 4;
+    options.exchange_interval  = 1;
+    WHEN("It runs with an exchange after every sweep")
+    {
+      auto const report = runner.run(options, degree_action);
+      THEN("Every replica flipped and every exchange was accepted")
+      {
+        REQUIRE_EQ(report.replicas.size(), 4);
+        for (auto const& replica_report : report.replicas)
+        {
+          CHECK_EQ(replica_report.flips, 40);
+        }
+        CHECK_EQ(report.flips(), 160);
+        // Pairs (0, 1) and (2, 3), then (1, 2), twice over
+        CHECK_EQ(report.exchanges_attempted, 6);
+        CHECK_EQ(report.exchanges_accepted, 6);
+      }
+      THEN("Couplings moved between replicas, but meshes did not")
+      {
+        std::set<std::size_t> parameters;
+        for (std::size_t i = 0; i < runner.size(); ++i)
+        {
+          auto const& replica = runner.replica_at(i);
+          CHECK_EQ(replica.parameter, i);
+          CHECK(replica.triangulation.tds().is_valid());
+          CHECK_EQ(count_degree_action(replica.triangulation),
+                   degree_action(replica.engine.stars()->sums()));
+          parameters.insert(runner.replica(i).parameter);
+        }
+        CHECK_EQ(parameters.size(), 4);
+        CHECK_NE(&runner.replica_at(0), &runner.replica(0));
+      }
+    }
+  }
+  GIVEN("A runner with distinct couplings and no exchanges")
+  {
+    Replica_runner         runner({0.0, 1.0}, Point_distribution::CUBE, 40, 93);
+    Replica_runner_options options;
+    options.sweep.target_flips = 10;
+    options.sweeps             = 3;
+    options.exchange_interval  = 0;
+    WHEN("It runs")
+    {
+      auto const report = runner.run(options, degree_action);
+      THEN("Each replica keeps its coupling")
+      {
+        CHECK_EQ(report.flips(), 60);
+        CHECK_EQ(report.exchanges_attempted, 0);
+        CHECK_EQ(runner.replica(0).parameter, 0);
+        CHECK_EQ(runner.replica(1).parameter, 1);
+      }
+    }
+  }
+}
+
+SCENARIO("Sample each coupling's distribution by Metropolis" *
+         doctest::test_suite("replica_runner"))
+{
+  GIVEN("Replicas at no coupling and a strong coupling")
+  {
+    Replica_runner         runner({0.0, 1.0}, Point_distribution::CUBE, 40, 94);
+    Replica_runner_options options;
+    options.sweep.target_flips = 20;
+    options.exchange_interval  = 0;
+    WHEN("They run for several sweeps")
+    {
+      auto const initial =
+          count_degree_action(runner.replica(1).triangulation);
+      std::array<double, 2> sums{};
+      std::size_t           flips        = 0;
+      std::size_t           not_accepted = 0;
+      for (std::size_t sweep = 0; sweep < 10; ++sweep)
+      {
+        auto const report = runner.run(options, degree_action);
+        flips += report.replicas[0].flips;
+        not_accepted += report.replicas[0].rejected(Flip_status::NOT_ACCEPTED);
+        for (std::size_t i = 0; i < 2; ++i)
+        {
+          sums[i] += count_degree_action(runner.replica(i).triangulation);
+        }
+      }
+      THEN("Without coupling only the proposal ratio declines flips")
+      {
+        // A flip changes the number of pivot edges by at most 8
+        CHECK_LT(not_accepted * 4, flips);
+      }
+      THEN("The strong coupling lowers the mean action")
+      {
+        CHECK_LT(sums[1], sums[0]);
+        CHECK_LT(sums[1] / 10.0, initial);
+      }
+    }
+  }
+}
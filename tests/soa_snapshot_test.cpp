@@ -0,0 +1,123 @@
+/// @file soa_snapshot_test.cpp
+/// @brief Export a triangulation to flat arrays for analysis kernels
+/// @author Adam Getchell
+/// @details Test functions defined in soa_snapshot.hpp against the same
+/// quantities measured on the triangulation
+/// @date 2026-10-16
+
+#include "soa_snapshot.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "random_triangulation.hpp"
+
+SCENARIO("Export a triangulation to a structure of arrays" *
+         doctest::test_suite("soa_snapshot"))
+{
+  GIVEN("A Delaunay triangulation")
+  {
+    auto const triangulation = make_random_triangulation(60, 31);
+    WHEN("It is exported")
+    {
+      auto const snapshot = make_soa_snapshot(triangulation);
+      THEN("Every vertex and cell is copied")
+      {
+        CHECK_EQ(snapshot.number_of_vertices(),
+                 triangulation.number_of_vertices() + 1);
+        CHECK_EQ(snapshot.number_of_cells(), triangulation.number_of_cells());
+        auto const mask = finite_cell_mask(snapshot);
+        CHECK_EQ(std::accumulate(mask.begin(), mask.end(), std::size_t{0}),
+                 triangulation.number_of_finite_cells());
+      }
+      THEN("The coordinates are in vertex order")
+      {
+        std::size_t index = 1;
+        for (auto const& vertex : finite_vertices_view(triangulation))
+        {
+          CHECK_EQ(snapshot.x[index], vertex->point().x());
+          CHECK_EQ(snapshot.y[index], vertex->point().y());
+          CHECK_EQ(snapshot.z[index], vertex->point().z());
+          ++index;
+        }
+      }
+      THEN("Neighbors are mutual and share 3 vertices")
+      {
+        for (std::size_t c = 0; c < snapshot.number_of_cells(); ++c)
+        {
+          for (std::size_t i = 0; i < 4; ++i)
+          {
+            auto const  neighbor = snapshot.cell_neighbors[i][c];
+            std::size_t shared = 0;
+            bool        mutual = false;
+            for (std::size_t j = 0; j < 4; ++j)
+            {
+              mutual |= snapshot.cell_neighbors[j][neighbor] == c;
+              for (std::size_t k = 0; k < 4; ++k)
+              {
+                shared += static_cast<std::size_t>(
+                    snapshot.cell_vertices[j][neighbor] ==
+                    snapshot.cell_vertices[k][c]);
+              }
+            }
+            REQUIRE(mutual);
+            REQUIRE_EQ(shared, 3);
+          }
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Compute statistics from a structure of arrays" *
+         doctest::test_suite("soa_snapshot"))
+{
+  GIVEN("A triangulation and its snapshot")
+  {
+    auto const triangulation = make_random_triangulation(60, 32);
+    auto const snapshot      = make_soa_snapshot(triangulation);
+    THEN("Vertex degrees match those of the triangulation")
+    {
+      auto const  degrees = vertex_degrees(snapshot);
+      std::size_t index   = 1;
+      for (auto const& vertex : finite_vertices_view(triangulation))
+      {
+        CHECK_EQ(degrees[index++], triangulation.degree(vertex));
+      }
+      CHECK_EQ(degrees[0],
+               triangulation.degree(triangulation.infinite_vertex()));
+    }
+    THEN("Edge valences match those of the triangulation")
+    {
+      auto const valences = edge_valences(snapshot);
+      auto const edges    = get_finite_edges(triangulation);
+      REQUIRE_EQ(valences.edges.size(), edges.size());
+      std::vector<std::uint32_t> expected;
+      for (auto const& edge : edges)
+      {
+        expected.push_back(static_cast<std::uint32_t>(
+            count_finite_incident_cells(triangulation, edge)));
+      }
+      std::sort(expected.begin(), expected.end());
+      auto actual = valences.valences;
+      std::sort(actual.begin(), actual.end());
+      CHECK_EQ(actual, expected);
+    }
+    THEN("Every finite cell has positive volume")
+    {
+      auto const statistics = sweep_statistics(snapshot);
+      CHECK_EQ(statistics.inverted_cells, 0);
+      auto const vertices = std::accumulate(
+          statistics.degree_histogram.begin(),
+          statistics.degree_histogram.end(), std::size_t{0});
+      CHECK_EQ(vertices, triangulation.number_of_vertices());
+      CHECK_GT(statistics.mean_degree, 4.0);
+      CHECK_GT(statistics.mean_valence, 2.0);
+    }
+  }
+}
@@ -0,0 +1,151 @@
+/// @file star_cache_test.cpp
+/// @brief Keep vertex degrees and edge valences up to date across flips
+/// @author Adam Getchell
+/// @details Test functions defined in star_cache.hpp against the same
+/// quantities counted from scratch
+/// @date 2026-10-16
+
+#include "star_cache.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "flip_journal.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// @return The first successful plan for an edge of the triangulation
+  auto find_plan(Delaunay const& triangulation, std::size_t skip)
+      -> std::optional<Flip_plan>
+  {
+    for (auto const& edge : get_finite_edges(triangulation))
+    {
+      for (auto const& plan : plan_flips(triangulation, edge))
+      {
+        if (plan && skip-- == 0) { return plan; }
+      }
+    }
+    return std::nullopt;
+  }
+
+  /// @return True if the cache agrees with the triangulation everywhere
+  auto matches(Star_cache<Delaunay> const& cache,
+               Delaunay const&             triangulation) -> bool
+  {
+    Star_sums sums;
+    for (auto const& vertex : finite_vertices_view(triangulation))
+    {
+      std::vector<Cell_handle> cells;
+      triangulation.tds().incident_cells(vertex, std::back_inserter(cells));
+      if (cache.incident_cells(vertex) != cells.size() ||
+          cache.degree(vertex) != triangulation.degree(vertex))
+      {
+        return false;
+      }
+      sums.degree_squares += std::int64_t{cache.degree(vertex)} *
+                             std::int64_t{cache.degree(vertex)};
+    }
+    for (auto const& edge : finite_edges_view(triangulation))
+    {
+      auto const   first  = edge.first->vertex(edge.second);
+      auto const   second = edge.first->vertex(edge.third);
+      auto         cell   = triangulation.incident_cells(edge, edge.first);
+      std::int64_t cells  = 0;
+      do {
+        ++cells;
+      } while (++cell != edge.first);
+      if (cache.valence(first, second) != cells) { return false; }
+      sums.valence_squares += cells * cells;
+    }
+    // Euler's formula for the triangulated 3-sphere, infinite vertex included
+    return cache.sums() == sums &&
+           cache.number_of_edges() == triangulation.number_of_vertices() + 1 +
+                                          triangulation.number_of_cells();
+  }
+}  // namespace
+
+SCENARIO("Count vertex and edge stars" * doctest::test_suite("star_cache"))
+{
+  GIVEN("A Delaunay triangulation")
+  {
+    auto triangulation = make_random_triangulation(60, 101);
+    for (auto const& vertex : finite_vertices_view(triangulation))
+    {
+      vertex->info() = -1;
+    }
+    WHEN("A cache is built")
+    {
+      Star_cache<Delaunay> const cache(triangulation);
+      THEN("The vertices are numbered and every star is counted")
+      {
+        CHECK_EQ(cache.id_of(triangulation.infinite_vertex()), 60);
+        CHECK(matches(cache, triangulation));
+      }
+      THEN("The vertex info is left alone")
+      {
+        for (auto const& vertex : finite_vertices_view(triangulation))
+        {
+          CHECK_EQ(vertex->info(), -1);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Update stars with each flip" * doctest::test_suite("star_cache"))
+{
+  GIVEN("A cache of a triangulation")
+  {
+    auto                 triangulation = make_random_triangulation(60, 102);
+    Star_cache<Delaunay> cache(triangulation);
+    WHEN("Flips are applied and the cache is updated with each")
+    {
+      std::size_t flips = 0;
+      for (std::size_t skip = 0; flips < 20 && skip < 200; skip += 7)
+      {
+        auto const plan = find_plan(triangulation, skip);
+        if (!plan) { break; }
+        auto const before = cache.sums();
+        auto const delta  = cache.delta(*plan);
+        REQUIRE(apply_flip(triangulation, *plan));
+        cache.update(*plan);
+        ++flips;
+        CHECK_EQ(cache.sums().degree_squares,
+                 before.degree_squares + delta.degree_squares);
+        CHECK_EQ(cache.sums().valence_squares,
+                 before.valence_squares + delta.valence_squares);
+      }
+      REQUIRE_GT(flips, 0);
+      THEN("It matches the flipped triangulation")
+      {
+        CHECK(triangulation.tds().is_valid());
+        CHECK(matches(cache, triangulation));
+      }
+    }
+    WHEN("A flip is undone and reverted")
+    {
+      auto const   sums = cache.sums();
+      Flip_journal journal;
+      auto const   plan = find_plan(triangulation, 0);
+      REQUIRE(plan);
+      auto const& cell = plan->cells[0];
+      Edge_handle const edge{cell, cell->index(plan->pivot_from_1),
+                             cell->index(plan->pivot_from_2)};
+      REQUIRE(journal.flip(triangulation, edge, plan->top, plan->bottom));
+      cache.update(journal.back().plan);
+      REQUIRE(matches(cache, triangulation));
+      cache.revert(journal.back().plan);
+      static_cast<void>(journal.undo(triangulation));
+      THEN("The cache is as before")
+      {
+        CHECK_EQ(cache.sums(), sums);
+        CHECK(matches(cache, triangulation));
+      }
+    }
+  }
+}
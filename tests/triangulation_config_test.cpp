@@ -0,0 +1,235 @@
+/// @file triangulation_config_test.cpp
+/// @brief Flip triangulations with other vertex and cell info
+/// @author Adam Getchell
+/// @details Test functions defined in triangulation_config.hpp, and the
+/// flip functions, moves and engines instantiated for them
+/// @date 2026-10-16
+
+#include "triangulation_config.hpp"
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "flip_engine.hpp"
+#include "pachner_moves.hpp"
+#include "random_triangulation.hpp"
+#include "weighted_sampler.hpp"
+
+namespace {
+  /// A caller-defined cell payload
+  struct Payload
+  {
+    double       weight{1.0};
+    std::int32_t label{-1};
+  };
+
+  using Payload_delaunay = Delaunay_with_cell_payload<Payload>;
+
+  static_assert(std::is_same_v<Delaunay, Delaunay_triangulation<K, int, int>>);
+  static_assert(Has_info<Compact_delaunay::Vertex>);
+  static_assert(!Has_info<Compact_delaunay::Cell>);
+  static_assert(std::is_same_v<Indexed_delaunay::Vertex::Info, std::uint32_t>);
+  static_assert(std::is_same_v<Indexed_delaunay::Cell::Info, std::uint32_t>);
+  static_assert(std::is_same_v<Payload_delaunay::Cell::Info, Payload>);
+
+  /// Flip the first pivot edge that can be flipped, trying each choice of
+  /// top and bottom vertices
+  template <typename Triangulation>
+  auto flip_any(Triangulation& triangulation)
+      -> Basic_flip_result<Triangulation>
+  {
+    for (auto const& edge : get_finite_edges(triangulation))
+    {
+      auto const cells = get_octahedron_cells(triangulation, edge);
+      if (!cells) { continue; }
+      auto const vertices = get_octahedron_vertices(*cells);
+      if (!vertices) { continue; }
+      for (auto const& top : *vertices)
+      {
+        for (auto const& bottom : *vertices)
+        {
+          if (auto result = bistellar_flip(triangulation, edge, top, bottom))
+          {
+            return result;
+          }
+        }
+      }
+    }
+    return Basic_flip_result<Triangulation>{};
+  }
+}  // namespace
+
+SCENARIO("Flip a triangulation without cell info" *
+         doctest::test_suite("triangulation_config"))
+{
+  GIVEN("A compact triangulation with vertex ids")
+  {
+    auto triangulation = make_random_triangulation<Compact_delaunay>(40, 6);
+    std::uint32_t id   = 0;
+    for (auto const& vertex : finite_vertices_view(triangulation))
+    {
+      vertex->info() = id++;
+    }
+    auto const cells = triangulation.number_of_cells();
+    REQUIRE(find_pivot_edge(triangulation));
+    WHEN("A bistellar flip is done")
+    {
+      auto const result = flip_any(triangulation);
+      REQUIRE(result);
+      THEN("The triangulation is valid with the same number of cells")
+      {
+        CHECK(triangulation.tds().is_valid());
+        CHECK(is_locally_valid(triangulation, result.cells));
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+      }
+      THEN("The vertex ids are kept")
+      {
+        std::vector<bool> seen(triangulation.number_of_vertices());
+        for (auto const& vertex : finite_vertices_view(triangulation))
+        {
+          REQUIRE_LT(vertex->info(), seen.size());
+          CHECK_FALSE(seen[vertex->info()]);
+          seen[vertex->info()] = true;
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Flip a triangulation with cell ids" *
+         doctest::test_suite("triangulation_config"))
+{
+  GIVEN("A triangulation whose cells are numbered from 1")
+  {
+    auto triangulation = make_random_triangulation<Indexed_delaunay>(40, 8);
+    std::uint32_t id   = 0;
+    for (auto const& cell : finite_cells_view(triangulation))
+    {
+      cell->info() = ++id;
+    }
+    WHEN("A bistellar flip is done")
+    {
+      auto const result = flip_any(triangulation);
+      REQUIRE(result);
+      THEN("The new cells have id 0, as created cells would")
+      {
+        CHECK(triangulation.tds().is_valid());
+        for (auto const& cell : result.cells) { CHECK_EQ(cell->info(), 0); }
+      }
+      THEN("The other cells keep their ids")
+      {
+        std::vector<bool> seen(id + 1);
+        std::uint32_t     kept = 0;
+        for (auto const& cell : finite_cells_view(triangulation))
+        {
+          if (cell->info() == 0) { continue; }
+          REQUIRE_LE(cell->info(), id);
+          CHECK_FALSE(seen[cell->info()]);
+          seen[cell->info()] = true;
+          ++kept;
+        }
+        CHECK_EQ(kept, id - 4);
+      }
+    }
+  }
+}
+
+SCENARIO("Flip a triangulation with a cell payload" *
+         doctest::test_suite("triangulation_config"))
+{
+  GIVEN("A triangulation whose cells carry a payload")
+  {
+    auto triangulation = make_random_triangulation<Payload_delaunay>(40, 7);
+    for (auto const& cell : finite_cells_view(triangulation))
+    {
+      cell->info() = Payload{2.0, 3};
+    }
+    WHEN("A bistellar flip is done")
+    {
+      auto const result = flip_any(triangulation);
+      REQUIRE(result);
+      THEN("The new cells have a default payload, as created cells would")
+      {
+        CHECK(triangulation.tds().is_valid());
+        for (auto const& cell : result.cells)
+        {
+          CHECK_EQ(cell->info().weight, 1.0);
+          CHECK_EQ(cell->info().label, -1);
+        }
+      }
+      THEN("The other cells keep their payload")
+      {
+        for (auto const& cell : finite_cells_view(triangulation))
+        {
+          if (std::find(result.cells.begin(), result.cells.end(), cell) !=
+              result.cells.end())
+          {
+            continue;
+          }
+          CHECK_EQ(cell->info().label, 3);
+        }
+      }
+    }
+  }
+}
+
+SCENARIO("Run the engine and moves on a triangulation without cell info" *
+         doctest::test_suite("triangulation_config"))
+{
+  GIVEN("A compact triangulation")
+  {
+    auto triangulation = make_random_triangulation<Compact_delaunay>(64, 9);
+    auto const cells = triangulation.number_of_cells();
+    WHEN("The engine flips it")
+    {
+      Basic_flip_engine<Compact_delaunay> engine(triangulation, 3);
+      Flip_engine_options                 options;
+      options.target_flips = 20;
+      auto const report    = engine.run(options);
+      THEN("The flips succeed and the triangulation is valid")
+      {
+        CHECK_GT(report.flips, 0);
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+        CHECK_EQ(engine.index().size(),
+                 Basic_pivot_edge_index<Compact_delaunay>(triangulation)
+                     .size());
+      }
+    }
+    WHEN("A 2-3 move is made and undone by a journal")
+    {
+      Basic_move_journal<Compact_delaunay> journal;
+      auto const cell = *finite_cells_view(triangulation).begin();
+      bool       moved = false;
+      for (int facet = 0; facet < 4 && !moved; ++facet)
+      {
+        moved =
+            static_cast<bool>(journal.two_three(triangulation, cell, facet));
+      }
+      REQUIRE(moved);
+      REQUIRE(journal.undo(triangulation));
+      THEN("The triangulation is restored")
+      {
+        CHECK(journal.empty());
+        CHECK(triangulation.tds().is_valid());
+        CHECK_EQ(triangulation.number_of_cells(), cells);
+      }
+    }
+    WHEN("Pivot edges are sampled by weight")
+    {
+      Basic_weighted_edge_sampler<Compact_delaunay> const sampler(
+          triangulation);
+      THEN("Every pivot edge is weighed")
+      {
+        CHECK_EQ(sampler.size(),
+                 Basic_pivot_edge_index<Compact_delaunay>(triangulation)
+                     .size());
+      }
+    }
+  }
+}
@@ -0,0 +1,273 @@
+/// @file triangulation_io_test.cpp
+/// @brief Save and load triangulations as binary snapshots
+/// @author Adam Getchell
+/// @details Test functions defined in triangulation_io.hpp
+/// @date 2026-10-16
+
+#include "triangulation_io.hpp"
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bistellar_flip.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// Flip the first pivot edge that can be flipped, trying each choice of
+  /// top and bottom vertices
+  template <typename Triangulation>
+  auto flip_any(Triangulation& triangulation) -> bool
+  {
+    for (auto const& edge : get_finite_edges(triangulation))
+    {
+      auto const cells = get_octahedron_cells(triangulation, edge);
+      if (!cells) { continue; }
+      auto const vertices = get_octahedron_vertices(*cells);
+      if (!vertices) { continue; }
+      for (auto const& top : *vertices)
+      {
+        for (auto const& bottom : *vertices)
+        {
+          if (bistellar_flip(triangulation, edge, top, bottom)) { return true; }
+        }
+      }
+    }
+    return false;
+  }
+
+  /// Make up to count flips
+  template <typename Triangulation>
+  auto flip_some(Triangulation& triangulation, std::size_t count)
+      -> std::size_t
+  {
+    std::size_t flips = 0;
+    while (flips < count && flip_any(triangulation)) { ++flips; }
+    return flips;
+  }
+
+  /// The snapshot of a triangulation, as bytes
+  template <typename Triangulation>
+  auto to_bytes(Triangulation const& triangulation) -> std::string
+  {
+    std::ostringstream out(std::ios::binary);
+    REQUIRE_EQ(write_snapshot(triangulation, out), Snapshot_status::SUCCESS);
+    return out.str();
+  }
+
+  /// The bytes of a string, as read_snapshot() takes them
+  auto as_bytes(std::string const& bytes) -> std::span<std::byte const>
+  {
+    return {reinterpret_cast<std::byte const*>(bytes.data()), bytes.size()};
+  }
+
+  /// A file in the temporary directory, removed on scope exit
+  struct Temporary_file
+  {
+    std::filesystem::path path{std::filesystem::temp_directory_path() /
+                               "bistellar_flip_snapshot_test.bin"};
+    Temporary_file()                                         = default;
+    Temporary_file(Temporary_file const&)                    = delete;
+    auto operator=(Temporary_file const&) -> Temporary_file& = delete;
+    ~Temporary_file() { std::filesystem::remove(path); }
+  };
+}  // namespace
+
+SCENARIO("Save and load a flipped triangulation" *
+         doctest::test_suite("triangulation_io"))
+{
+  GIVEN("A triangulation that is no longer Delaunay")
+  {
+    auto triangulation = make_random_triangulation<Delaunay>(50, 21);
+    REQUIRE_GT(flip_some(triangulation, 10), 0);
+    std::vector<int> ids;
+    for (auto const& cell : finite_cells_view(triangulation))
+    {
+      cell->info() = static_cast<int>(ids.size());
+      ids.push_back(cell->info());
+    }
+    WHEN("It is saved to a file and loaded")
+    {
+      Temporary_file const file;
+      REQUIRE_EQ(save_snapshot(triangulation, file.path),
+                 Snapshot_status::SUCCESS);
+      Delaunay loaded;
+      REQUIRE_EQ(load_snapshot(file.path, loaded), Snapshot_status::SUCCESS);
+      THEN("The loaded triangulation is valid with the same size")
+      {
+        CHECK(loaded.tds().is_valid());
+        CHECK_EQ(loaded.dimension(), 3);
+        CHECK_EQ(loaded.number_of_vertices(),
+                 triangulation.number_of_vertices());
+        CHECK_EQ(loaded.number_of_cells(), triangulation.number_of_cells());
+        CHECK_EQ(loaded.number_of_finite_cells(),
+                 triangulation.number_of_finite_cells());
+      }
+      THEN("The points and cell info are kept in order")
+      {
+        auto       original = finite_vertices_view(triangulation).begin();
+        auto const vertices = finite_vertices_view(loaded);
+        for (auto const& vertex : vertices)
+        {
+          CHECK_EQ(vertex->point(), (*original)->point());
+          ++original;
+        }
+        std::vector<int> loaded_ids;
+        for (auto const& cell : finite_cells_view(loaded))
+        {
+          loaded_ids.push_back(cell->info());
+        }
+        CHECK_EQ(loaded_ids, ids);
+      }
+      THEN("Saving it again gives the same bytes")
+      {
+        CHECK_EQ(to_bytes(loaded), to_bytes(triangulation));
+      }
+      THEN("It can be flipped")
+      {
+        CHECK_GT(flip_some(loaded, 5), 0);
+        CHECK(loaded.tds().is_valid());
+      }
+    }
+  }
+}
+
+SCENARIO("Save and load a triangulation without cell info" *
+         doctest::test_suite("triangulation_io"))
+{
+  GIVEN("A compact triangulation with vertex ids")
+  {
+    auto triangulation = make_random_triangulation<Compact_delaunay>(30, 22);
+    std::uint32_t id   = 0;
+    for (auto const& vertex : finite_vertices_view(triangulation))
+    {
+      vertex->info() = id++;
+    }
+    auto const bytes = to_bytes(triangulation);
+    WHEN("It is read back")
+    {
+      Compact_delaunay loaded;
+      REQUIRE_EQ(read_snapshot(as_bytes(bytes), loaded),
+                 Snapshot_status::SUCCESS);
+      THEN("It is valid and the vertex ids are kept")
+      {
+        CHECK(loaded.tds().is_valid());
+        std::uint32_t expected = 0;
+        for (auto const& vertex : finite_vertices_view(loaded))
+        {
+          CHECK_EQ(vertex->info(), expected++);
+        }
+      }
+    }
+    WHEN("It is read as a triangulation with other info")
+    {
+      Delaunay loaded;
+      THEN("The header is rejected")
+      {
+        CHECK_EQ(read_snapshot(as_bytes(bytes), loaded),
+                 Snapshot_status::BAD_HEADER);
+      }
+    }
+  }
+}
+
+SCENARIO("Reject damaged snapshots" * doctest::test_suite("triangulation_io"))
+{
+  GIVEN("The snapshot of a triangulation")
+  {
+    auto const triangulation = make_random_triangulation<Delaunay>(30, 23);
+    auto       bytes         = to_bytes(triangulation);
+    Delaunay   loaded;
+    // Where neighbor i of cell c is stored
+    Snapshot_header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    auto const neighbor_at = [&header](std::size_t c, std::size_t i) {
+      return sizeof(header) +
+             (header.number_of_vertices - 1) *
+                 (3 * sizeof(double) + header.vertex_info_size) +
+             (header.number_of_cells + c) * 4 * sizeof(std::uint32_t) +
+             i * sizeof(std::uint32_t);
+    };
+    auto const neighbor = [&](std::size_t c, std::size_t i) {
+      std::uint32_t index = 0;
+      std::memcpy(&index, bytes.data() + neighbor_at(c, i), sizeof(index));
+      return index;
+    };
+    auto const set_neighbor = [&](std::size_t c, std::size_t i,
+                                  std::uint32_t index) {
+      std::memcpy(bytes.data() + neighbor_at(c, i), &index, sizeof(index));
+    };
+    WHEN("It is truncated")
+    {
+      bytes.resize(bytes.size() - 1);
+      THEN("Its size is wrong")
+      {
+        CHECK_EQ(read_snapshot(as_bytes(bytes), loaded),
+                 Snapshot_status::WRONG_SIZE);
+      }
+    }
+    WHEN("Its magic number is changed")
+    {
+      bytes[0] = 'X';
+      THEN("The header is rejected")
+      {
+        CHECK_EQ(read_snapshot(as_bytes(bytes), loaded),
+                 Snapshot_status::BAD_HEADER);
+      }
+    }
+    WHEN("A neighbor index is out of range")
+    {
+      set_neighbor(0, 0, 0xFFFFFFFF);
+      THEN("It is corrupt and nothing is loaded")
+      {
+        CHECK_EQ(read_snapshot(as_bytes(bytes), loaded),
+                 Snapshot_status::CORRUPT);
+        CHECK_EQ(loaded.number_of_vertices(), 0);
+      }
+    }
+    WHEN("A neighbor is not adjacent to the cell")
+    {
+      // A cell that does not have cell 0 as a neighbor
+      std::uint32_t other = 1;
+      while (neighbor(other, 0) == 0 || neighbor(other, 1) == 0 ||
+             neighbor(other, 2) == 0 || neighbor(other, 3) == 0)
+      {
+        ++other;
+      }
+      set_neighbor(0, 0, other);
+      THEN("The neighbors are not mutual, so it is corrupt")
+      {
+        CHECK_EQ(read_snapshot(as_bytes(bytes), loaded),
+                 Snapshot_status::CORRUPT);
+        CHECK_EQ(loaded.number_of_vertices(), 0);
+      }
+    }
+    WHEN("Two neighbors of a cell are swapped")
+    {
+      auto const first  = neighbor(0, 0);
+      auto const second = neighbor(0, 1);
+      set_neighbor(0, 0, second);
+      set_neighbor(0, 1, first);
+      THEN("They are mutual but share the wrong facets, so it is corrupt")
+      {
+        CHECK_EQ(read_snapshot(as_bytes(bytes), loaded),
+                 Snapshot_status::CORRUPT);
+        CHECK_EQ(loaded.number_of_vertices(), 0);
+      }
+    }
+    WHEN("The file does not exist")
+    {
+      THEN("It cannot be opened")
+      {
+        CHECK_EQ(load_snapshot("no/such/snapshot.bin", loaded),
+                 Snapshot_status::CANNOT_OPEN);
+      }
+    }
+  }
+}
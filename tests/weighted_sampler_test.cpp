@@ -0,0 +1,172 @@
+/// @file weighted_sampler_test.cpp
+/// @brief Propose pivot edges with non-uniform probability
+/// @author Adam Getchell
+/// @details Test functions defined in weighted_sampler.hpp
+/// @date 2026-10-16
+
+#include "weighted_sampler.hpp"
+
+#include <CGAL/Kernel/global_functions_3.h>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "flip_engine.hpp"
+#include "pivot_edge_index.hpp"
+#include "random_triangulation.hpp"
+
+namespace {
+  /// Weigh an edge by its squared length, which depends only on the edge
+  struct Squared_length_weight
+  {
+    auto operator()(Delaunay const& /* triangulation */,
+                    Edge_handle const& edge) const -> double
+    {
+      return CGAL::squared_distance(edge.first->vertex(edge.second)->point(),
+                                    edge.first->vertex(edge.third)->point());
+    }
+  };
+}  // namespace
+
+SCENARIO("Keep prefix sums of weights in a Fenwick tree" *
+         doctest::test_suite("weighted_sampler"))
+{
+  GIVEN("A Fenwick tree of 10 weights")
+  {
+    Fenwick_tree        tree;
+    std::vector<double> weights{3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+    for (auto const weight : weights) { tree.push_back(weight); }
+    THEN("Every prefix sum is correct")
+    {
+      double sum = 0.0;
+      for (std::size_t i = 0; i <= weights.size(); ++i)
+      {
+        CHECK_EQ(tree.prefix(i), doctest::Approx(sum));
+        if (i < weights.size()) { sum += weights[i]; }
+      }
+      CHECK_EQ(tree.total(), doctest::Approx(39.0));
+    }
+    THEN("Each point of the total is found in the right position")
+    {
+      CHECK_EQ(tree.find(0.0), 0);
+      CHECK_EQ(tree.find(2.9), 0);
+      CHECK_EQ(tree.find(3.0), 1);
+      CHECK_EQ(tree.find(8.5), 3);
+      CHECK_EQ(tree.find(38.9), 9);
+    }
+    WHEN("Weights are changed and removed")
+    {
+      tree.set(5, 0.0);
+      tree.set(0, 10.0);
+      tree.pop_back();
+      THEN("The sums follow, and zero weights are never found")
+      {
+        CHECK_EQ(tree.size(), 9);
+        CHECK_EQ(tree.total(), doctest::Approx(34.0));
+        CHECK_EQ(tree.find(21.0), 6);
+        CHECK_EQ(tree.find(23.0), 7);
+        auto const total = tree.total();
+        tree.rebuild();
+        CHECK_EQ(tree.total(), doctest::Approx(total));
+      }
+    }
+  }
+}
+
+SCENARIO("Sample pivot edges by weight" *
+         doctest::test_suite("weighted_sampler"))
+{
+  GIVEN("A triangulation")
+  {
+    auto const triangulation = make_random_triangulation(60, 51);
+    WHEN("Every pivot edge has the same weight")
+    {
+      Weighted_edge_sampler<> const sampler(triangulation);
+      THEN("The sampler holds the same edges as the index")
+      {
+        Pivot_edge_index const index(triangulation);
+        CHECK_EQ(sampler.size(), index.size());
+        CHECK_EQ(sampler.total_weight(),
+                 doctest::Approx(static_cast<double>(index.size())));
+        std::mt19937_64 generator(52);
+        for (int i = 0; i < 100; ++i)
+        {
+          auto const edge = sampler.sample(generator);
+          REQUIRE(edge);
+          CHECK_EQ(count_finite_incident_cells(triangulation, *edge), 4);
+        }
+      }
+    }
+    WHEN("Edges are weighted by squared length")
+    {
+      Weighted_edge_sampler<Squared_length_weight> const sampler(
+          triangulation);
+      REQUIRE_GT(sampler.size(), 1);
+      THEN("Longer edges are sampled more often, in proportion")
+      {
+        std::mt19937_64 generator(53);
+        double          mean  = 0.0;
+        int const       count = 20000;
+        for (int i = 0; i < count; ++i)
+        {
+          auto const edge = sampler.sample(generator);
+          REQUIRE(edge);
+          mean += Squared_length_weight{}(triangulation, *edge);
+        }
+        mean /= count;
+        // Sampled by weight, the mean weight is E[w^2] / E[w]
+        double sum         = 0.0;
+        double sum_squares = 0.0;
+        for (auto const& edge : pivot_edges_view(triangulation))
+        {
+          auto const weight = Squared_length_weight{}(triangulation, edge);
+          sum += weight;
+          sum_squares += weight * weight;
+        }
+        CHECK_EQ(mean, doctest::Approx(sum_squares / sum).epsilon(0.05));
+      }
+    }
+  }
+}
+
+SCENARIO("Update weights after flips" *
+         doctest::test_suite("weighted_sampler"))
+{
+  GIVEN("A triangulation and a weighted sampler")
+  {
+    auto triangulation = make_random_triangulation(60, 54);
+    Weighted_edge_sampler<Squared_length_weight> sampler(triangulation);
+    std::mt19937_64                              generator(55);
+    WHEN("Sampled edges are flipped and the sampler updated")
+    {
+      std::size_t flips = 0;
+      for (int i = 0; i < 200 && flips < 20; ++i)
+      {
+        auto const edge = sampler.sample(generator);
+        REQUIRE(edge);
+        auto const key    = make_vertex_pair(*edge);
+        auto const result = bistellar_flip(triangulation, *edge);
+        sampler.update(triangulation, key, result);
+        if (result) { ++flips; }
+      }
+      REQUIRE_GT(flips, 0);
+      THEN("It matches a sampler built from scratch")
+      {
+        Weighted_edge_sampler<Squared_length_weight> const fresh(
+            triangulation);
+        CHECK_EQ(sampler.size(), fresh.size());
+        CHECK_EQ(sampler.total_weight(),
+                 doctest::Approx(fresh.total_weight()));
+        for (auto const& edge : pivot_edges_view(triangulation))
+        {
+          auto const first  = edge.first->vertex(edge.second);
+          auto const second = edge.first->vertex(edge.third);
+          CHECK_EQ(sampler.weight(first, second),
+                   doctest::Approx(fresh.weight(first, second)));
+        }
+      }
+    }
+  }
+}